@@ -27,6 +27,11 @@
 #include <stdexcept>
 #include <string>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #define LOCK_OBJECT(_T_, _M_) std::lock_guard<_T_> __LOCK_##_M_(_M_)
 #define REFERENCE_PARAMETER(_P_) ((void) _P_)
 #define SHOW_GLOBAL_EXCEPTION_HEADER false
@@ -61,7 +61,7 @@ _uuidl_t::operator=(
 bool 
 _uuidl_t::operator==(
 	const _uuidl_t &other
-	)
+	) const
 {
 	return block0 == other.block0
 			&& block1 == other.block1;
@@ -102,6 +102,21 @@ generate_long_id(
 	return result;
 }
 
+void 
+generate_long_ids(
+	size_t count,
+	std::vector<uuidl_t> &output,
+	bool register_id
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, __uuid_lock);
+
+	if(!__uuid_initialize) {
+		THROW_UUID_EXCEPTION(UUID_EXCEPTION_LIB_UNINITIALIZED);
+	}
+	__uuid_generator.generate_long_ids(count, output, register_id);
+}
+
 uuids_t 
 generate_short_id(
 	bool register_id
@@ -130,6 +145,19 @@ initialize(void)
 	__uuid_initialize = true;
 }
 
+void 
+initialize_generator(
+	_uuid_generator &generator
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, __uuid_lock);
+
+	if(!__uuid_initialize) {
+		THROW_UUID_EXCEPTION(UUID_EXCEPTION_LIB_UNINITIALIZED);
+	}
+	generator.initialize((uint32_t) __uuid_generator.generate_short_id(false));
+}
+
 bool 
 is_unique_long_id(
 	const uuidl_t &long_id
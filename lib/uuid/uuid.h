@@ -21,13 +21,17 @@
 #define UUID_H_
 
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define IS_LONG_ID_EQUAL(_UL0_, _UL1_)\
 	(_UL0_.block0 == _UL1_.block0 && _UL0_.block1 == _UL1_.block1)
 #define IS_SHORT_ID_EQUAL(_US0_, _US1_) (_US0_ == _US1_)
+#define LONG_ID_HASH_MIX 0xff51afd7ed558ccdULL
+#define LONG_ID_HASH_MULTIPLIER 0x9e3779b97f4a7c15ULL
 #define VALUE_AS_HEX(_T_, _V_)\
 	std::setw(sizeof(_T_) * 2) << std::setfill('0') << std::hex << ((unsigned) _V_) << std::dec
 #define SHORT_ID_AS_STRING(_UL_)\
@@ -44,6 +48,8 @@
 
 typedef uint64_t uuids_t, *uuids_ptr;
 
+class _uuid_generator;
+
 typedef class _uuidl_t {
 
 	public:
@@ -62,7 +68,7 @@ typedef class _uuidl_t {
 
 		bool operator==(
 			const _uuidl_t &other
-			);
+			) const;
 
 		friend bool operator<(
 			const _uuidl_t &left,
@@ -75,6 +81,25 @@ typedef class _uuidl_t {
 
 } uuidl_t, *uuidl_ptr;
 
+namespace std {
+
+	template<> struct hash<uuidl_t> {
+
+		size_t operator()(
+			const uuidl_t &long_id
+			) const
+		{
+			uint64_t result = long_id.block0 ^ (long_id.block1 * LONG_ID_HASH_MULTIPLIER);
+
+			result ^= (result >> 0x21);
+			result *= LONG_ID_HASH_MIX;
+			result ^= (result >> 0x21);
+
+			return (size_t) result;
+		}
+	};
+}
+
 namespace uuid {
 
 	static uuidl_t NULL_LONG_ID;
@@ -88,6 +113,12 @@ namespace uuid {
 		bool register_id
 		);
 
+	void generate_long_ids(
+		size_t count,
+		std::vector<uuidl_t> &output,
+		bool register_id = true
+		);
+
 	uuids_t generate_short_id(
 		bool register_id = true
 		);
@@ -98,6 +129,10 @@ namespace uuid {
 
 	void initialize(void);
 
+	void initialize_generator(
+		_uuid_generator &generator
+		);
+
 	bool is_unique_long_id(
 		const uuidl_t &long_id
 		);
@@ -51,22 +51,59 @@ _uuid_generator::operator=(
 	return *this;
 }
 
+uuidl_t 
+_uuid_generator::_as_long_id(
+	uuids_t short_id
+	)
+{
+	uuidl_t result;
+
+	result.block0 = short_id;
+
+	return result;
+}
+
+void 
+_uuid_generator::_certify_period(void)
+{
+	size_t i = 0, j;
+	uint32_t bit, inner = 0,
+		parity[MT_BLOCK_WIDTH] = { MT_PARITY_0, MT_PARITY_1, MT_PARITY_2, MT_PARITY_3 };
+
+	for(; i < MT_BLOCK_WIDTH; ++i) {
+		inner ^= _mt_value.at(i) & parity[i];
+	}
+
+	for(i = 0x10; i > 0; i >>= 1) {
+		inner ^= inner >> i;
+	}
+
+	if(inner & 1) {
+		return;
+	}
+
+	for(i = 0; i < MT_BLOCK_WIDTH; ++i) {
+
+		for(j = 0, bit = 1; j < (sizeof(uint32_t) * 8); ++j, bit <<= 1) {
+
+			if(bit & parity[i]) {
+				_mt_value.at(i) ^= bit;
+				return;
+			}
+		}
+	}
+}
+
 uint32_t 
 _uuid_generator::_generate_value(void)
 {
-	uint32_t result;
 
-	if(!_mt_value_position) {
+	if(_mt_value_position >= MT_VALUE_LENGTH) {
 		_regenerate_values();
+		_mt_value_position = 0;
 	}
-	result = _mt_value.at(_mt_value_position);
-	_mt_value_position %= MT_VALUE_LENGTH;
-	result ^= (result >> 0xb);
-	result ^= ((result << 0x7) & 0x9d2c5680);
-	result ^= ((result << 0xf) & 0xefc60000);
-	result ^= (result >> 0x12);
 
-	return result;
+	return _mt_value.at(_mt_value_position++);
 }
 		
 void 
@@ -82,24 +119,69 @@ _uuid_generator::_initialize(
 	_mt_value.at(0) = seed;
 
 	for(; i < MT_VALUE_LENGTH; ++i) {
-		_mt_value.at(i) = (uint32_t) (0x6c078965 * (_mt_value.at(i - 1) ^ (_mt_value.at(i - 1) >> 0x1e)) + i);
+		_mt_value.at(i) = (uint32_t) (MT_INITIALIZE_MULTIPLIER * (_mt_value.at(i - 1) ^ (_mt_value.at(i - 1) >> 0x1e)) + i);
 	}
+	_certify_period();
+	_mt_value_position = MT_VALUE_LENGTH;
 }
 
 void 
 _uuid_generator::_regenerate_values(void)
 {
-	size_t i = 0;
-	uint32_t value;
+	size_t i = 0, position = MT_BLOCK_POSITION;
+#ifdef SIMD_SSE2
+	__m128i *block = (__m128i *) &_mt_value[0], value,
+		mask = _mm_set_epi32((int) MT_MASK_3, (int) MT_MASK_2, (int) MT_MASK_1, (int) MT_MASK_0),
+		previous = _mm_loadu_si128(block + (MT_BLOCK_LENGTH - 2)), 
+		current = _mm_loadu_si128(block + (MT_BLOCK_LENGTH - 1));
 
-	for(; i < MT_VALUE_LENGTH; ++i) {
-		value = (_mt_value.at(i) & 0x80000000) + (_mt_value.at((i + 1) % MT_VALUE_LENGTH) & 0x7fffffff);
-		_mt_value.at(i) = _mt_value.at((i + 0x18d) % MT_VALUE_LENGTH) ^ (value >> 1);
+	for(; i < MT_BLOCK_LENGTH; ++i, ++position) {
 
-		if(value % 2) {
-			_mt_value.at(i) ^= 0x9908b0df;
+		if(position == MT_BLOCK_LENGTH) {
+			position = 0;
 		}
+		value = _mm_loadu_si128(block + i);
+		value = _mm_xor_si128(_mm_xor_si128(_mm_xor_si128(value, _mm_slli_si128(value, MT_SHIFT_LEFT_BYTE)),
+			_mm_xor_si128(_mm_srli_si128(previous, MT_SHIFT_RIGHT_BYTE), _mm_slli_epi32(current, MT_SHIFT_LEFT))),
+			_mm_and_si128(_mm_srli_epi32(_mm_loadu_si128(block + position), MT_SHIFT_RIGHT), mask));
+		_mm_storeu_si128(block + i, value);
+		previous = current;
+		current = value;
 	}
+#else
+	size_t j, previous = MT_BLOCK_LENGTH - 2, current = MT_BLOCK_LENGTH - 1;
+	uint32_t *block, *block_current, *block_position, *block_previous, 
+		mask[MT_BLOCK_WIDTH] = { MT_MASK_0, MT_MASK_1, MT_MASK_2, MT_MASK_3 };
+	uint64_t high, low, shift_high[2], shift_low[2];
+
+	for(; i < MT_BLOCK_LENGTH; ++i, ++position) {
+
+		if(position == MT_BLOCK_LENGTH) {
+			position = 0;
+		}
+		block = &_mt_value[i * MT_BLOCK_WIDTH];
+		block_current = &_mt_value[current * MT_BLOCK_WIDTH];
+		block_position = &_mt_value[position * MT_BLOCK_WIDTH];
+		block_previous = &_mt_value[previous * MT_BLOCK_WIDTH];
+		high = ((uint64_t) block[3] << 0x20) | block[2];
+		low = ((uint64_t) block[1] << 0x20) | block[0];
+		shift_high[0] = (high << (MT_SHIFT_LEFT_BYTE * 8)) | (low >> (0x40 - (MT_SHIFT_LEFT_BYTE * 8)));
+		shift_low[0] = low << (MT_SHIFT_LEFT_BYTE * 8);
+		high = ((uint64_t) block_previous[3] << 0x20) | block_previous[2];
+		low = ((uint64_t) block_previous[1] << 0x20) | block_previous[0];
+		shift_high[1] = high >> (MT_SHIFT_RIGHT_BYTE * 8);
+		shift_low[1] = (low >> (MT_SHIFT_RIGHT_BYTE * 8)) | (high << (0x40 - (MT_SHIFT_RIGHT_BYTE * 8)));
+
+		for(j = 0; j < MT_BLOCK_WIDTH; ++j) {
+			block[j] ^= (uint32_t) ((j < 2 ? shift_low[0] : shift_high[0]) >> ((j % 2) * 0x20))
+				^ (uint32_t) ((j < 2 ? shift_low[1] : shift_high[1]) >> ((j % 2) * 0x20))
+				^ ((block_position[j] >> MT_SHIFT_RIGHT) & mask[j])
+				^ (block_current[j] << MT_SHIFT_LEFT);
+		}
+		previous = current;
+		current = i;
+	}
+#endif
 }
 
 void 
@@ -133,6 +215,47 @@ _uuid_generator::generate_long_id(
 	return result;
 }
 
+void 
+_uuid_generator::generate_long_ids(
+	size_t count,
+	std::vector<uuidl_t> &output,
+	bool register_id
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
+
+	uuidl_t id;
+	size_t iter = 0;
+	std::vector<uuidl_t> batch;
+
+	batch.reserve(count);
+
+	for(; iter < count; ++iter) {
+		id.block0 = (((uint64_t) _generate_value() << 0x20)) | _generate_value();
+		id.block1 = (((uint64_t) _generate_value() << 0x20)) | _generate_value();
+		batch.push_back(id);
+	}
+
+	if(register_id) {
+		_registered_long_id.reserve(_registered_long_id.size() + count);
+
+		try {
+
+			for(iter = 0; iter < count; ++iter) {
+				register_long_id(batch.at(iter));
+			}
+		} catch(std::runtime_error &) {
+
+			for(; iter > 0; --iter) {
+				_registered_long_id.erase(batch.at(iter - 1));
+			}
+			throw;
+		}
+	}
+
+	output.insert(output.end(), batch.begin(), batch.end());
+}
+
 uuids_t 
 _uuid_generator::generate_short_id(
 	bool register_id
@@ -176,7 +299,7 @@ _uuid_generator::is_unique_long_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 	
-	return _registered_long_id.find(long_id) == _registered_long_id.end();
+	return !_registered_long_id.contains(long_id);
 }
 
 bool 
@@ -186,7 +309,7 @@ _uuid_generator::is_unique_short_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 
-	return _registered_short_id.find(short_id) == _registered_short_id.end();
+	return !_registered_short_id.contains(_as_long_id(short_id));
 }
 
 void 
@@ -196,13 +319,12 @@ _uuid_generator::register_long_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 
-	if(_registered_long_id.find(long_id) != _registered_long_id.end()){ 
+	if(!_registered_long_id.insert(long_id)) { 
 		THROW_UUID_GENERATOR_EXCEPTION_WITH_MESSAGE(
 			UUID_GENERATOR_EXCEPTION_ID_ALREADY_REGISTERED,
 			"{" << LONG_ID_AS_STRING(long_id) << "}"
 			);
 	}
-	_registered_long_id.insert(long_id);
 }
 
 void 
@@ -212,13 +334,12 @@ _uuid_generator::register_short_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 
-	if(_registered_short_id.find(short_id) != _registered_short_id.end()){ 
+	if(!_registered_short_id.insert(_as_long_id(short_id))) { 
 		THROW_UUID_GENERATOR_EXCEPTION_WITH_MESSAGE(
 			UUID_GENERATOR_EXCEPTION_ID_ALREADY_REGISTERED,
 			"{" << SHORT_ID_AS_STRING(short_id) << "}"
 			);
 	}
-	_registered_short_id.insert(short_id);
 }
 
 void 
@@ -228,15 +349,12 @@ _uuid_generator::unregister_long_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 
-	std::set<uuidl_t>::iterator long_id_iter = _registered_long_id.find(long_id);
-
-	if(long_id_iter == _registered_long_id.end()) {
+	if(!_registered_long_id.erase(long_id)) {
 		THROW_UUID_GENERATOR_EXCEPTION_WITH_MESSAGE(
 			UUID_GENERATOR_EXCEPTION_ID_NOT_REGISTERED,
 			"{" << LONG_ID_AS_STRING(long_id) << "}"
 			);
 	}
-	_registered_long_id.erase(long_id_iter);
 }
 
 void 
@@ -246,13 +364,10 @@ _uuid_generator::unregister_short_id(
 {
 	LOCK_OBJECT(std::recursive_mutex, _uuid_generator_lock);
 
-	std::set<uuids_t>::iterator short_id_iter = _registered_short_id.find(short_id);
-
-	if(short_id_iter == _registered_short_id.end()) {
+	if(!_registered_short_id.erase(_as_long_id(short_id))) {
 		THROW_UUID_GENERATOR_EXCEPTION_WITH_MESSAGE(
 			UUID_GENERATOR_EXCEPTION_ID_NOT_REGISTERED,
 			"{" << SHORT_ID_AS_STRING(short_id) << "}"
 			);
 	}
-	_registered_short_id.erase(short_id_iter);
 }
\ No newline at end of file
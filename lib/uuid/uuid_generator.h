@@ -20,10 +20,10 @@
 #ifndef UUID_GENERATOR_H_
 #define UUID_GENERATOR_H_
 
-#include <set>
 #include <vector>
 #include "type.h"
 #include "uuid.h"
+#include "uuid_hash_set.h"
 
 typedef class _uuid_generator {
 
@@ -47,6 +47,12 @@ typedef class _uuid_generator {
 			bool register_id
 			);
 
+		void generate_long_ids(
+			size_t count,
+			std::vector<uuidl_t> &output,
+			bool register_id
+			);
+
 		uuids_t generate_short_id(
 			bool register_id
 			);
@@ -85,6 +91,12 @@ typedef class _uuid_generator {
 
 	protected:
 
+		static uuidl_t _as_long_id(
+			uuids_t short_id
+			);
+
+		void _certify_period(void);
+
 		uint32_t _generate_value(void);
 		
 		void _initialize(
@@ -99,9 +111,9 @@ typedef class _uuid_generator {
 
 		uint32_t _mt_value_position;
 
-		std::set<uuidl_t> _registered_long_id;
+		uuid_hash_set _registered_long_id;
 
-		std::set<uuids_t> _registered_short_id;
+		uuid_hash_set _registered_short_id;
 
 	private:
 
@@ -33,6 +33,22 @@ static const std::string UUID_GENERATOR_STR[] = {
 };
 
 #define MAX_UUID_GENERATOR_EXCEPTION UUID_GENERATOR_EXCEPTION_ID_NOT_REGISTERED
+#define MT_BLOCK_LENGTH (MT_VALUE_LENGTH / MT_BLOCK_WIDTH)
+#define MT_BLOCK_POSITION 0x7a
+#define MT_BLOCK_WIDTH 4
+#define MT_INITIALIZE_MULTIPLIER 0x6c078965
+#define MT_MASK_0 0xdfffffef
+#define MT_MASK_1 0xddfecb7f
+#define MT_MASK_2 0xbffaffff
+#define MT_MASK_3 0xbffffff6
+#define MT_PARITY_0 0x00000001
+#define MT_PARITY_1 0x00000000
+#define MT_PARITY_2 0x00000000
+#define MT_PARITY_3 0x13c9e684
+#define MT_SHIFT_LEFT 0x12
+#define MT_SHIFT_LEFT_BYTE 1
+#define MT_SHIFT_RIGHT 0xb
+#define MT_SHIFT_RIGHT_BYTE 1
 #define MT_VALUE_LENGTH 0x270
 #define SHOW_UUID_GENERATOR_HEADER true
 #define UUID_GENERATOR_EXCEPTION_HEADER "UUID_GENERATOR"
@@ -0,0 +1,240 @@
+/*
+ * uuid_hash_set.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "uuid_hash_set.h"
+#include "uuid_hash_set_type.h"
+
+_uuid_hash_set::_uuid_hash_set(void)
+{
+	clear();
+}
+
+_uuid_hash_set::_uuid_hash_set(
+	const _uuid_hash_set &other
+	) :
+		_null_id(other._null_id),
+		_size(other._size),
+		_slot(other._slot)
+{
+	return;
+}
+
+_uuid_hash_set::~_uuid_hash_set(void)
+{
+	return;
+}
+
+_uuid_hash_set &
+_uuid_hash_set::operator=(
+	const _uuid_hash_set &other
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	if(this != &other) {
+		_null_id = other._null_id;
+		_size = other._size;
+		_slot = other._slot;
+	}
+
+	return *this;
+}
+
+size_t 
+_uuid_hash_set::_find_slot(
+	const uuidl_t &id
+	)
+{
+	size_t mask = (_slot.size() / UUID_HASH_SET_SLOT_WIDTH) - 1, result = _hash(id) & mask;
+
+	while(!_is_slot_empty(result)
+			&& (_slot[result * UUID_HASH_SET_SLOT_WIDTH] != id.block0
+			|| _slot[(result * UUID_HASH_SET_SLOT_WIDTH) + 1] != id.block1)) {
+		result = (result + 1) & mask;
+	}
+
+	return result;
+}
+
+bool 
+_uuid_hash_set::_is_slot_empty(
+	size_t position
+	)
+{
+	return !_slot[position * UUID_HASH_SET_SLOT_WIDTH]
+			&& !_slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1];
+}
+
+void 
+_uuid_hash_set::_resize(
+	size_t slot_count
+	)
+{
+	uuidl_t id;
+	size_t i = 0, mask = slot_count - 1, position;
+	std::vector<uuids_t> slot(slot_count * UUID_HASH_SET_SLOT_WIDTH, 0);
+
+	for(; i < _slot.size(); i += UUID_HASH_SET_SLOT_WIDTH) {
+		id.block0 = _slot[i];
+		id.block1 = _slot[i + 1];
+
+		if(!IS_LONG_ID_NULL(id)) {
+			position = _hash(id) & mask;
+
+			while(slot[position * UUID_HASH_SET_SLOT_WIDTH]
+					|| slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1]) {
+				position = (position + 1) & mask;
+			}
+			slot[position * UUID_HASH_SET_SLOT_WIDTH] = id.block0;
+			slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1] = id.block1;
+		}
+	}
+	_slot.swap(slot);
+}
+
+void 
+_uuid_hash_set::clear(void)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	_null_id = false;
+	_size = 0;
+	_slot.assign(UUID_HASH_SET_SLOT_COUNT_MIN * UUID_HASH_SET_SLOT_WIDTH, 0);
+}
+
+bool 
+_uuid_hash_set::contains(
+	const uuidl_t &id
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	if(IS_LONG_ID_NULL(id)) {
+		return _null_id;
+	}
+
+	return !_is_slot_empty(_find_slot(id));
+}
+
+bool 
+_uuid_hash_set::erase(
+	const uuidl_t &id
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	uuidl_t next_id;
+	size_t home, mask, next, position;
+
+	if(IS_LONG_ID_NULL(id)) {
+
+		if(!_null_id) {
+			return false;
+		}
+		_null_id = false;
+		--_size;
+
+		return true;
+	}
+	position = _find_slot(id);
+
+	if(_is_slot_empty(position)) {
+		return false;
+	}
+	mask = (_slot.size() / UUID_HASH_SET_SLOT_WIDTH) - 1;
+
+	for(next = (position + 1) & mask; !_is_slot_empty(next); next = (next + 1) & mask) {
+		next_id.block0 = _slot[next * UUID_HASH_SET_SLOT_WIDTH];
+		next_id.block1 = _slot[(next * UUID_HASH_SET_SLOT_WIDTH) + 1];
+		home = _hash(next_id) & mask;
+
+		if(((next - home) & mask) >= ((next - position) & mask)) {
+			_slot[position * UUID_HASH_SET_SLOT_WIDTH] = next_id.block0;
+			_slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1] = next_id.block1;
+			position = next;
+		}
+	}
+	_slot[position * UUID_HASH_SET_SLOT_WIDTH] = 0;
+	_slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1] = 0;
+	--_size;
+
+	return true;
+}
+
+bool 
+_uuid_hash_set::insert(
+	const uuidl_t &id
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	size_t position;
+
+	if(IS_LONG_ID_NULL(id)) {
+
+		if(_null_id) {
+			return false;
+		}
+		_null_id = true;
+		++_size;
+
+		return true;
+	}
+	position = _find_slot(id);
+
+	if(!_is_slot_empty(position)) {
+		return false;
+	}
+
+	if(IS_UUID_HASH_SET_FULL(_size + 1, _slot.size() / UUID_HASH_SET_SLOT_WIDTH)) {
+		_resize((_slot.size() / UUID_HASH_SET_SLOT_WIDTH) * 2);
+		position = _find_slot(id);
+	}
+	_slot[position * UUID_HASH_SET_SLOT_WIDTH] = id.block0;
+	_slot[(position * UUID_HASH_SET_SLOT_WIDTH) + 1] = id.block1;
+	++_size;
+
+	return true;
+}
+
+void 
+_uuid_hash_set::reserve(
+	size_t count
+	)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	size_t slot_count = _slot.size() / UUID_HASH_SET_SLOT_WIDTH;
+
+	while(IS_UUID_HASH_SET_FULL(count, slot_count)) {
+		slot_count *= 2;
+	}
+
+	if(slot_count != (_slot.size() / UUID_HASH_SET_SLOT_WIDTH)) {
+		_resize(slot_count);
+	}
+}
+
+size_t 
+_uuid_hash_set::size(void)
+{
+	LOCK_OBJECT(std::recursive_mutex, _uuid_hash_set_lock);
+
+	return _size;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * uuid_hash_set.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UUID_HASH_SET_H_
+#define UUID_HASH_SET_H_
+
+#include <vector>
+#include "type.h"
+#include "uuid.h"
+
+typedef class _uuid_hash_set {
+
+	public:
+
+		_uuid_hash_set(void);
+
+		_uuid_hash_set(
+			const _uuid_hash_set &other
+			);
+
+		virtual ~_uuid_hash_set(void);
+
+		_uuid_hash_set &operator=(
+			const _uuid_hash_set &other
+			);
+
+		void clear(void);
+
+		bool contains(
+			const uuidl_t &id
+			);
+
+		bool erase(
+			const uuidl_t &id
+			);
+
+		bool insert(
+			const uuidl_t &id
+			);
+
+		void reserve(
+			size_t count
+			);
+
+		size_t size(void);
+
+	protected:
+
+		size_t _find_slot(
+			const uuidl_t &id
+			);
+
+		bool _is_slot_empty(
+			size_t position
+			);
+
+		void _resize(
+			size_t slot_count
+			);
+
+		std::hash<uuidl_t> _hash;
+
+		bool _null_id;
+
+		size_t _size;
+
+		std::vector<uuids_t> _slot;
+
+	private:
+
+		std::recursive_mutex _uuid_hash_set_lock;
+
+} uuid_hash_set, *uuid_hash_set_ptr;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+/*
+ * uuid_hash_set_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UUID_HASH_SET_TYPE_H_
+#define UUID_HASH_SET_TYPE_H_
+
+#include "type.h"
+
+#define UUID_HASH_SET_SLOT_COUNT_MIN 0x400
+#define UUID_HASH_SET_SLOT_WIDTH 2
+
+#define IS_LONG_ID_NULL(_UL_) (!(_UL_).block0 && !(_UL_).block1)
+#define IS_UUID_HASH_SET_FULL(_S_, _C_) (((_S_) * 2) >= (_C_))
+
+class _uuid_hash_set;
+typedef _uuid_hash_set uuid_hash_set, *uuid_hash_set_ptr;
+
+#endif
\ No newline at end of file
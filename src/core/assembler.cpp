@@ -17,11 +17,15 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include "assembler.h"
 #include "assembler_type.h"
 #include "lang_def.h"
+#include "lexer_base_type.h"
 #include "lexer_type.h"
+#include "parser_type.h"
 
 _assembler::_assembler(void)
 {
@@ -53,7 +57,7 @@ _assembler::operator=(
 	const _assembler &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	if(this != &other) {
 		initialize(other);
@@ -62,25 +66,188 @@ _assembler::operator=(
 	return *this;
 }
 
-std::vector<word_t> & 
+void 
+_assembler::_define_label(
+	token_view &label_token,
+	word_t offset
+	)
+{
+	symid_t symbol = label_token.get_symbol();
+
+	if(symbol >= _label_offset.size()) {
+		_label_offset.resize(symbol + 1, INVALID_TYPE);
+	} else if(_label_offset[symbol] != INVALID_TYPE) {
+		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+			ASSEMBLER_EXCEPTION_LABEL_REDEFINITION,
+			label_token.to_string(false)
+			);
+	}
+	_label_offset[symbol] = offset;
+}
+
+void 
+_assembler::_encode_statement(
+	nodeid_t statement
+	)
+{
+	const char *text;
+	token_view tok;
+	size_t i, length;
+	assembler_operand_t oper_a, oper_b;
+	nodeid_t child, value_list;
+	std::unordered_map<tokid_t, std::vector<word_t>>::iterator bin_include_iter;
+
+	tok = get_token_view(get_node(statement).get_id());
+
+	switch(tok.get_type()) {
+		case TOKEN_BEGIN:
+		case TOKEN_LABEL:
+			break;
+		case TOKEN_BASIC_OPCODE:
+
+			if(get_node(statement).size() != OPCODE_BASIC_OPERAND_COUNT) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					tok.to_string(false)
+					);
+			}
+			child = get_node(statement).get_first_child();
+			oper_b = _evaluate_operand(child);
+			oper_a = _evaluate_operand(get_node(child).get_next_sibling());
+			_binary_file.push_back(DEFINE_OPCODE_BASIC(OPCODE_BASIC_VALUE(tok.get_subtype()), oper_a.value, oper_b.value));
+
+			if(oper_a.has_next_word) {
+				_binary_file.push_back(oper_a.next_word);
+			}
+
+			if(oper_b.has_next_word) {
+				_binary_file.push_back(oper_b.next_word);
+			}
+			break;
+		case TOKEN_DIRECTIVE:
+
+			switch(tok.get_subtype()) {
+				case DIRECTIVE_DATA:
+					if(!get_node(statement).has_children()) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					value_list = get_node(statement).get_first_child();
+
+					for(child = get_node(value_list).get_first_child(); child != INVALID_NODE_ID; 
+							child = get_node(child).get_next_sibling()) {
+						tok = get_token_view(get_node(child).get_id());
+
+						if(tok.get_type() == TOKEN_LABEL) {
+							_binary_file.push_back(_resolve_label(tok));
+						} else {
+
+							switch(tok.get_subtype()) {
+								case VALUE_HEXIDECIMAL:
+								case VALUE_INTEGER:
+									_binary_file.push_back(_evaluate_value(tok, false));
+									break;
+								case VALUE_STRING_VAR:
+									text = tok.get_text_data();
+									length = tok.get_text_length();
+
+									for(i = 0; i < length; ++i) {
+										_binary_file.push_back((word_t) text[i]);
+									}
+									break;
+								default:
+									THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+										ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+										tok.to_string(false)
+										);
+							}
+						}
+					}
+					break;
+				case DIRECTIVE_INCBIN:
+					bin_include_iter = _binary_include.find(tok.get_id());
+
+					if(bin_include_iter == _binary_include.end()) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					_binary_file.insert(_binary_file.end(), bin_include_iter->second.begin(), bin_include_iter->second.end());
+					break;
+				case DIRECTIVE_RESERVE:
+					child = get_node(statement).get_first_child();
+
+					if(child == INVALID_NODE_ID) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					tok = get_token_view(get_node(child).get_id());
+
+					if(tok.get_type() != TOKEN_VALUE
+							|| tok.get_subtype() != VALUE_INTEGER) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					length = _evaluate_value(tok);
+
+					for(i = 0; i < length; ++i) {
+						_binary_file.push_back(ASSEMBLER_RESERVED_VALUE);
+					}
+					break;
+				default:
+					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+						tok.to_string(false)
+						);
+			}
+			break;
+		case TOKEN_SPECIAL_OPCODE:
+
+			if(get_node(statement).size() != OPCODE_SPECIAL_OPERAND_COUNT) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					tok.to_string(false)
+					);
+			}
+			oper_a = _evaluate_operand(get_node(statement).get_first_child());
+			_binary_file.push_back(DEFINE_OPCODE_SPECIAL(OPCODE_SPECIAL_VALUE(tok.get_subtype()), oper_a.value));
+
+			if(oper_a.has_next_word) {
+				_binary_file.push_back(oper_a.next_word);
+			}
+			break;
+		default:
+			THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+				ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+				tok.to_string(false)
+				);
+	}
+}
+
+assembler_operand_t 
 _assembler::_evaluate_operand(
-	std::vector<node> &statement,
-	size_t position
+	nodeid_t operand
 	)
 {
-	size_t child_position;
+	nodeid_t child;
 	bool found_register = false;
-	token oper_token, value_token;
-	std::vector<word_t> result, next_word;
-	std::map<uuidl_t, std::vector<word_t>>::iterator value_iter;
+	token_view oper_token, value_token;
+	assembler_operand_t result = { 0, false, 0 };
 
-	if(position >= statement.size()) {
+	if(operand == INVALID_NODE_ID) {
 		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
 			ASSEMBLER_EXCEPTION_INVALID_STATEMENT_POSITION,
-			"pos. " << position
+			"pos. " << operand
 			);
 	}
-	oper_token = get_token(statement.at(position).get_id());
+	oper_token = get_token_view(get_node(operand).get_id());
 
 	if(oper_token.get_type() != TOKEN_OPERAND) {
 		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
@@ -88,670 +255,932 @@ _assembler::_evaluate_operand(
 			oper_token.to_string(false)
 			);
 	}
-	value_iter = _value.find(oper_token.get_id());
+	result.value = ADDRESSING_MODE_VALUE(oper_token.get_mode());
 
-	if(value_iter == _value.end()) {
-		result.push_back(ADDRESSING_MODE_VALUE(oper_token.get_mode()));
+	switch(oper_token.get_mode()) {
+		case ADDRESSING_MODE_REGISTER:
+		case ADDRESSING_MODE_INDIRECT_REGISTER:
 
-		switch(oper_token.get_mode()) {
-			case ADDRESSING_MODE_REGISTER:
-			case ADDRESSING_MODE_INDIRECT_REGISTER:
+			if(!get_node(operand).has_children()) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					oper_token.to_string(false)
+					);
+			}
+			child = get_node(operand).get_first_child();
+			value_token = get_token_view(get_node(child).get_id());
 
-				if(!statement.at(position).has_children()) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						oper_token.to_string(false)
-						);
+			if(value_token.get_type() != TOKEN_REGISTER) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					value_token.to_string(false)
+					);				
+			}
+			result.value += (word_t) value_token.get_subtype();
+			break;
+		case ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD:
+
+			if(!get_node(operand).has_children()) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					oper_token.to_string(false)
+					);
+			}
+			child = get_node(operand).get_first_child();
+			value_token = get_token_view(get_node(child).get_id());
+
+			if(value_token.get_type() != TOKEN_REGISTER) {
+				result.next_word = _evaluate_value(value_token, false);
+				result.has_next_word = true;
+			} else {
+				result.value += (word_t) value_token.get_subtype();
+				found_register = true;
+			}
+			child = get_node(child).get_next_sibling();
+
+			if(child == INVALID_NODE_ID) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					oper_token.to_string(false)
+					);
+			}
+			value_token = get_token_view(get_node(child).get_id());
+
+			if(found_register) {
+				result.next_word = _evaluate_value(value_token, false);
+				result.has_next_word = true;
+			} else {
+				result.value += (word_t) value_token.get_subtype();
+			}
+			break;
+		case ADDRESSING_MODE_PUSH_POP:
+		case ADDRESSING_MODE_PEEK:
+		case ADDRESSING_MODE_SP_LITERAL:
+		case ADDRESSING_MODE_PC_LITERAL:
+		case ADDRESSING_MODE_EX_LITERAL:
+			break;
+		case ADDRESSING_MODE_INDIRECT_NEXT_WORD:
+		case ADDRESSING_MODE_LITERAL:
+		case ADDRESSING_MODE_NEXT_WORD_LITERAL:
+		case ADDRESSING_MODE_PICK:
+
+			if(!get_node(operand).has_children()) {
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					oper_token.to_string(false)
+					);
+			}
+			child = get_node(operand).get_first_child();
+			value_token = get_token_view(get_node(child).get_id());
+			result.next_word = _evaluate_value(
+				value_token, 
+				oper_token.get_mode() == ADDRESSING_MODE_LITERAL
+				);
+			
+			if(oper_token.get_mode() == ADDRESSING_MODE_LITERAL) {
+				
+				if(result.next_word <= MAX_LITERAL) {
+					result.value += (result.next_word + 1);
 				}
-				child_position = statement.at(position).get_child_position(0);
+			} else {
+				result.has_next_word = true;
+			}
+			break;
+		default:
+			THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+				ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+				oper_token.to_string(false)
+				);
+	}
+
+	return result;
+}
+
+word_t 
+_assembler::_evaluate_value(
+	token_view &value_token,
+	bool literal_value
+	)
+{
+	word_t result = 0;
 
-				if(child_position >= statement.size()) {
+	if(value_token.get_type() != TOKEN_VALUE
+			&& value_token.get_type() != TOKEN_LABEL) {
+		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+			ASSEMBLER_EXCEPTION_EXPECTED_VALUE_NODE,
+			value_token.to_string(false)
+			);
+	}
+
+	if(value_token.get_type() == TOKEN_LABEL) {
+		result = _resolve_label(value_token);
+	} else {
+
+		switch(value_token.get_subtype()) {
+			case VALUE_HEXIDECIMAL:
+			case VALUE_INTEGER:
+
+				if(value_token.get_value() > MAX_WORD) {
 					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_INVALID_STATEMENT_POSITION,
-						"pos. " << child_position
+						ASSEMBLER_EXCEPTION_VALUE_OUT_OR_RANGE,
+						value_token.to_string(false)
 						);
 				}
-				value_token = get_token(statement.at(child_position).get_id());
+				result = (word_t) value_token.get_value();
+				break;
+			default:
+				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+					value_token.to_string(false)
+					);
+		}
 
-				if(value_token.get_type() != TOKEN_REGISTER) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						value_token.to_string(false)
-						);				
+		if(literal_value
+				&& result != MIN_LITERAL
+				&& result > MAX_LITERAL) {
+			THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+				ASSEMBLER_EXCEPTION_LITERAL_VALUE_OUT_OR_RANGE,
+				value_token.to_string(false)
+				);
+		}
+	}
+
+	return result;
+}
+
+bool 
+_assembler::_generate_pass_0(
+	bool encode
+	)
+{
+	size_t position;
+	token_view tok;
+	word_t offset = 0;
+	stmtid_t statement;
+	assembler_fixup_t entry;
+	assembler_pipeline_t pipeline;
+	std::exception_ptr error;
+	std::vector<assembler_fixup_t> fixup;
+	std::vector<assembler_fixup_t>::iterator fixup_iter;
+
+	if(_edit_dirty) {
+		parser::clear();
+		_binary_include.clear();
+		_layout.clear();
+	}
+	parser::reset();
+
+	if(!_pipeline_begin(pipeline)) {
+		_prefetch_includes();
+	}
+
+	if(encode) {
+		_binary_file.clear();
+	}
+	_label_conflict = false;
+	_label_offset.clear();
+	_layout_valid = false;
+	_line_statement.clear();
+
+	try {
+
+		while(has_next_statement()) {
+			statement = _layout_statement(offset);
+
+			if(statement != INVALID_STATEMENT_ID
+					&& _layout[statement].label != INVALID_SYMBOL_ID) {
+				tok = get_token_view(get_node(get_statement()).get_id());
+				_define_label(tok, offset);
+			}
+
+			if(encode
+					&& statement != INVALID_STATEMENT_ID) {
+				position = _binary_file.size();
+
+				try {
+
+					if(_has_undefined_label(statement)) {
+						entry.position = position;
+						entry.statement = statement;
+						fixup.push_back(entry);
+						_binary_file.resize(position + _layout[statement].size, ASSEMBLER_RESERVED_VALUE);
+					} else {
+						_encode_statement(get_statement());
+						encode = ((_binary_file.size() - position) == _layout[statement].size);
+					}
+				} catch(std::runtime_error &) {
+					encode = false;
+					error = std::current_exception();
 				}
-				result.front() += (word_t) value_token.get_subtype();
+			}
+
+			if(_statement[_current].next == PARSER_END_STATEMENT) {
+				_prefetch_includes(_pipeline_next(pipeline));
+			}
+			move_next_statement();
+		}
+	} catch(...) {
+		_pipeline_end(pipeline);
+		throw;
+	}
+	_pipeline_end(pipeline);
+	_edit_dirty = false;
+	_layout_valid = true;
+
+	if(encode
+			|| error) {
+
+		for(fixup_iter = fixup.begin(); fixup_iter != fixup.end(); ++fixup_iter) {
+			position = _binary_file.size();
+			_encode_statement(_statement[fixup_iter->statement].begin);
+
+			if(_binary_file.size() - position != _layout[fixup_iter->statement].size) {
+				encode = false;
+				error = std::exception_ptr();
 				break;
-			case ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD:
+			}
+			std::copy(_binary_file.begin() + position, _binary_file.end(), _binary_file.begin() + fixup_iter->position);
+			_binary_file.resize(position);
+		}
+	}
+
+	if(error) {
+		std::rethrow_exception(error);
+	}
+
+	return encode;
+}
+
+void 
+_assembler::_generate_pass_1(void)
+{
+	parser::reset();
+	_binary_file.clear();
 
-				if(!statement.at(position).has_children()) {
+	while(has_next_statement()) {
+		_encode_statement(get_statement());
+		move_next_statement();
+	}
+}
+
+bool 
+_assembler::_has_undefined_label(
+	stmtid_t statement
+	)
+{
+	symid_t symbol;
+	nodeid_t id = _statement[statement].begin + 1;
+
+	for(; id < _statement[statement].end; ++id) {
+
+		if(_token.get_type(_node_pool[id].get_id()) == TOKEN_LABEL) {
+			symbol = _token.get_symbol(_node_pool[id].get_id());
+
+			if(symbol >= _label_offset.size()
+					|| _label_offset[symbol] == INVALID_TYPE) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool 
+_assembler::_is_label_statement(
+	stmtid_t statement
+	)
+{
+	return statement != PARSER_END_STATEMENT
+			&& !_layout[statement].spliced
+			&& _layout[statement].label != INVALID_SYMBOL_ID;
+}
+
+stmtid_t 
+_assembler::_layout_statement(
+	word_t &offset
+	)
+{
+	word_t word;
+	size_t file_size;
+	word_t begin = offset;
+	size_t id, line, span;
+	tokid_t anchor, bin_id, token_base;
+	include_unit_ptr unit;
+	std::string unit_path;
+	token_view tok, value_tok;
+	std::vector<word_t> value;
+	stmtid_t result = _current;
+	nodeid_t child, statement, value_list;
+	assembler_layout_t layout = { INVALID_TOKEN_ID, INVALID_SYMBOL_ID, 0, 0, 0, false };
+
+	if(result >= _layout.size()) {
+		_layout.resize(_statement.size(), layout);
+	}
+	statement = get_statement();
+	tok = get_token_view(get_node(statement).get_id());
+	anchor = _layout[result].spliced ? _layout[result].anchor : tok.get_id();
+	line = _token.get_line(anchor);
+
+	switch(tok.get_type()) {
+		case TOKEN_BEGIN:
+			break;
+		case TOKEN_BASIC_OPCODE:
+		case TOKEN_SPECIAL_OPCODE:
+			++offset;
+
+			for(child = get_node(statement).get_first_child(); child != INVALID_NODE_ID; 
+					child = get_node(child).get_next_sibling()) {
+				tok = get_token_view(get_node(child).get_id());
+
+				if(tok.get_type() != TOKEN_OPERAND) {
 					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
 						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						oper_token.to_string(false)
+						tok.to_string(false)
 						);
 				}
-				child_position = statement.at(position).get_child_position(0);
 
-				if(child_position >= statement.size()) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_INVALID_STATEMENT_POSITION,
-						"pos. " << child_position
-						);
+				switch(tok.get_mode()) {
+					case ADDRESSING_MODE_REGISTER:
+					case ADDRESSING_MODE_INDIRECT_REGISTER:
+					case ADDRESSING_MODE_PUSH_POP:
+					case ADDRESSING_MODE_PEEK:
+					case ADDRESSING_MODE_SP_LITERAL:
+					case ADDRESSING_MODE_PC_LITERAL:
+					case ADDRESSING_MODE_EX_LITERAL:
+					case ADDRESSING_MODE_LITERAL:
+						break;
+					case ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD:
+					case ADDRESSING_MODE_PICK:
+					case ADDRESSING_MODE_INDIRECT_NEXT_WORD:
+					case ADDRESSING_MODE_NEXT_WORD_LITERAL:
+
+						if(tok.get_mode() == ADDRESSING_MODE_NEXT_WORD_LITERAL) {
+							
+							if(!get_node(child).size()) {
+								THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+									ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+									tok.to_string(false)
+									);
+							}
+							value_tok = get_token_view(get_node(get_node(child).get_first_child()).get_id());
+
+							if(value_tok.get_type() != TOKEN_LABEL) {
+								word = _evaluate_value(value_tok, false);
+							
+								if(word == MIN_LITERAL
+										|| word <= MAX_LITERAL) {
+									set_token_mode(get_node(child).get_id(), ADDRESSING_MODE_LITERAL);
+								} else {
+									++offset;
+								}
+							} else {
+								++offset;
+							}
+						} else {
+							++offset;
+						}
+						break;
+					default:
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
 				}
-				value_token = get_token(statement.at(child_position).get_id());
+			}
+			break;
+		case TOKEN_DIRECTIVE:
 
-				if(value_token.get_type() != TOKEN_REGISTER) {
-					next_word = _evaluate_value(get_token(statement.at(child_position).get_id()), false);
-					result.insert(result.end(), next_word.begin(), next_word.end());
-				} else {
-					result.front() += (word_t) value_token.get_subtype();
-					found_register = true;
-				}
-				child_position = statement.at(position).get_child_position(1);
+			switch(tok.get_subtype()) {
+				case DIRECTIVE_DATA:
+					if(!get_node(statement).has_children()) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					value_list = get_node(statement).get_first_child();
 
-				if(child_position >= statement.size()) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_INVALID_STATEMENT_POSITION,
-						"pos. " << child_position
+					for(child = get_node(value_list).get_first_child(); child != INVALID_NODE_ID; 
+							child = get_node(child).get_next_sibling()) {
+						tok = get_token_view(get_node(child).get_id());
+
+						if(tok.get_type() == TOKEN_LABEL) {
+							++offset;
+						} else {
+
+							switch(tok.get_subtype()) {
+								case VALUE_HEXIDECIMAL:
+								case VALUE_INTEGER:
+									++offset;
+									break;
+								case VALUE_STRING_VAR:
+									offset += (word_t) tok.get_text_length();
+									break;
+								default:
+									THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+										ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+										tok.to_string(false)
+										);
+							}
+						}
+					}
+					break;
+				case DIRECTIVE_INCBIN: {
+					bin_id = tok.get_id();
+					child = get_node(statement).get_first_child();
+
+					if(child == INVALID_NODE_ID) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					tok = get_token_view(get_node(child).get_id());
+					
+					if(tok.get_type() != TOKEN_VALUE
+							|| tok.get_subtype() != VALUE_STRING_VAR) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					std::ifstream file(
+						std::string(get_origin_path() + tok.get_text()).c_str(), 
+						std::ios::in | std::ios::binary
 						);
-				}
-				value_token = get_token(statement.at(child_position).get_id());
 
-				if(found_register) {
-					next_word = _evaluate_value(get_token(statement.at(child_position).get_id()), false);
-					result.insert(result.end(), next_word.begin(), next_word.end());
-				} else {
-					result.front() += (word_t) value_token.get_subtype();
-				}
-				break;
-			case ADDRESSING_MODE_PUSH_POP:
-			case ADDRESSING_MODE_PEEK:
-			case ADDRESSING_MODE_SP_LITERAL:
-			case ADDRESSING_MODE_PC_LITERAL:
-			case ADDRESSING_MODE_EX_LITERAL:
-				break;
-			case ADDRESSING_MODE_INDIRECT_NEXT_WORD:
-			case ADDRESSING_MODE_LITERAL:
-			case ADDRESSING_MODE_NEXT_WORD_LITERAL:
-			case ADDRESSING_MODE_PICK:
+					if(!file) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_INCLUDE_FILE_NOT_FOUND,
+							"\'" << tok.get_text() << "\'"
+							);
+					}
+					file_size = (size_t) file.tellg();
+					file.seekg(0, std::ios::end);
+					file_size = (size_t) file.tellg() - file_size;
+					file.seekg(0, std::ios::beg);
+
+					if(file_size % 2) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_BINARY_FILE_UNALIGNED,
+							"\'" << tok.get_text() << "\'"
+							);
+					}
+
+					while(file.peek() != EOF) {
+						file.read((char *) &word, sizeof(word_t));
+						value.push_back((word << BYTE_WIDTH) | (word >> BYTE_WIDTH));
+					}
+					file.close();
+					offset += (word_t) value.size();
+
+					if(offset > MAX_WORD) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_BINARY_FILE_TOO_LARGE,
+							"\'" << tok.get_text() << "\'"
+							);
+					}
+					_binary_include.insert(std::pair<tokid_t, std::vector<word_t>>(bin_id, value));
+					} break;
+				case DIRECTIVE_INCLUDE:
+					child = get_node(statement).get_first_child();
 
-				if(!statement.at(position).has_children()) {
+					if(child == INVALID_NODE_ID) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					tok = get_token_view(get_node(child).get_id());
+
+					if(tok.get_type() != TOKEN_VALUE
+							|| tok.get_subtype() != VALUE_STRING_VAR) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					span = _statement_line_end(result) - line;
+					remove_statement();
+					unit_path = get_origin_path() + tok.get_text();
+					unit = &_include_cache.load(unit_path);
+					token_base = import_tokens(unit->tokens, unit_path);
+					id = _statement.size();
+					import_statements(unit->statements, token_base);
+					_layout.resize(_statement.size(), layout);
+
+					for(; id < _layout.size(); ++id) {
+						_layout[id].anchor = anchor;
+						_layout[id].span = span;
+						_layout[id].spliced = true;
+					}
+					result = INVALID_STATEMENT_ID;
+					break;
+				case DIRECTIVE_RESERVE:
+					child = get_node(statement).get_first_child();
+
+					if(child == INVALID_NODE_ID) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					tok = get_token_view(get_node(child).get_id());
+
+					if(tok.get_type() != TOKEN_VALUE
+							|| tok.get_subtype() != VALUE_INTEGER) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+							tok.to_string(false)
+							);
+					}
+					offset += _evaluate_value(tok);
+
+					if(offset > MAX_WORD) {
+						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+							ASSEMBLER_EXCEPTION_RESERVATION_TOO_LARGE,
+							tok.to_string(false)
+							);
+					}
+					break;
+				default:
 					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
 						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						oper_token.to_string(false)
+						tok.to_string(false)
 						);
-				}
-				child_position = statement.at(position).get_child_position(0);
+			}
+			break;
+		case TOKEN_LABEL:
+			layout.label = tok.get_symbol();
+			break;
+		default:
+			THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+				ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
+				tok.to_string(false)
+				);
+	}
 
-				if(child_position >= statement.size()) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_INVALID_STATEMENT_POSITION,
-						"pos. " << child_position
-						);
-				}
-				next_word = _evaluate_value(
-					get_token(statement.at(child_position).get_id()), 
-					oper_token.get_mode() == ADDRESSING_MODE_LITERAL
-					);
-				
-				if(oper_token.get_mode() == ADDRESSING_MODE_LITERAL) {
-					
-					if(next_word.front() <= MAX_LITERAL) {
-						result.back() += (next_word.front() + 1);
-					}
-				} else {
-					result.insert(result.end(), next_word.begin(), next_word.end());
-				}
-				break;
-			default:
-				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-					oper_token.to_string(false)
-					);
+	if(result != INVALID_STATEMENT_ID) {
+		_layout[result].anchor = anchor;
+		_layout[result].label = layout.label;
+		_layout[result].offset = begin;
+		_layout[result].size = offset - begin;
+
+		if(line != INVALID_TYPE) {
+
+			if(line >= _line_statement.size()) {
+				_line_statement.resize(line + 1, INVALID_STATEMENT_ID);
+			}
+
+			if(_line_statement[line] == INVALID_STATEMENT_ID) {
+				_line_statement[line] = result;
+			}
 		}
-		_value.insert(std::pair<uuidl_t, std::vector<word_t>>(oper_token.get_id(), result));
-		value_iter = _value.find(oper_token.get_id());
 	}
 
-	return value_iter->second;
+	return result;
 }
 
-std::vector<word_t> &  
-_assembler::_evaluate_value(
-	token &value_token,
-	bool literal_value
+bool 
+_assembler::_pipeline_begin(
+	assembler_pipeline_t &pipeline
 	)
 {
-	char ch;
-	size_t value;
-	std::vector<word_t> result;
-	std::string::iterator ch_iter;
-	size_t i = 0, radix = INTEGER_RADIX;
-	std::map<std::string, word_t>::iterator label_iter;
-	std::map<uuidl_t, std::vector<word_t>>::iterator value_iter;
+	const char *end_stream;
+	std::vector<lexer_boundary_t> boundary;
+	size_t begin = lexer_base::_position, count, end, iter;
+
+	pipeline.chunk.clear();
+	pipeline.next = 0;
+
+	if(lexer::_position != (_token_position.size() - 2)
+			|| _statement.size() != (PARSER_END_STATEMENT + 1)
+			|| begin >= _input_size
+			|| THREAD_COUNT() < 2) {
+		return false;
+	}
+	end_stream = (const char *) memchr(_input_data + begin, CHARACTER_END_STREAM, _input_size - begin);
+	end = end_stream ? (end_stream - _input_data) : _input_size;
+	count = (end - begin) / PARSER_CHUNK_LENGTH_MIN;
 
-	if(value_token.get_type() != TOKEN_VALUE
-			&& value_token.get_type() != TOKEN_LABEL) {
-		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-			ASSEMBLER_EXCEPTION_EXPECTED_VALUE_NODE,
-			value_token.to_string(false)
-			);
+	if(count < 2) {
+		return false;
 	}
-	value_iter = _value.find(value_token.get_id());
+	boundary = _split_statements(end, count);
+	count = boundary.size() - 1;
 
-	if(value_iter == _value.end()) {
+	if(count < 2) {
+		return false;
+	}
+	_input->get_line_position(0);
+	_skip_characters(end);
+	pipeline.chunk.resize(count);
+	pipeline.worker.resize(THREAD_COUNT() - 1);
+	pipeline.worker_thread.resize(pipeline.worker.size());
+
+	for(iter = 0; iter < count; ++iter) {
+		pipeline.chunk.at(iter).begin = boundary.at(iter).position;
+		pipeline.chunk.at(iter).end = boundary.at(iter + 1).position;
+		pipeline.chunk.at(iter).complete = false;
+	}
+
+	for(iter = 0; iter < std::min(count, pipeline.worker.size()); ++iter) {
+		_pipeline_launch(pipeline, iter);
+	}
+
+	return true;
+}
 
-		if(value_token.get_type() == TOKEN_LABEL) {
-			label_iter = _label_offset.find(value_token.get_text());
+void 
+_assembler::_pipeline_end(
+	assembler_pipeline_t &pipeline
+	)
+{
+	size_t iter;
+
+	for(iter = 0; iter < pipeline.worker_thread.size(); ++iter) {
+
+		if(pipeline.worker_thread.at(iter).joinable()) {
+			pipeline.worker_thread.at(iter).join();
+		}
+	}
+	pipeline.next = pipeline.chunk.size();
+}
+
+void 
+_assembler::_pipeline_launch(
+	assembler_pipeline_t &pipeline,
+	size_t chunk
+	)
+{
+	size_t slot = chunk % pipeline.worker.size();
+
+	pipeline.worker.at(slot).initialize(*this, pipeline.chunk.at(chunk).begin, pipeline.chunk.at(chunk).end);
+	pipeline.worker_thread.at(slot) = std::thread(
+		&_parser::_discover_chunk, 
+		std::ref(pipeline.worker.at(slot)), 
+		std::ref(pipeline.chunk.at(chunk))
+		);
+}
+
+stmtid_t 
+_assembler::_pipeline_next(
+	assembler_pipeline_t &pipeline
+	)
+{
+	size_t slot;
+	tokid_t token_base;
+	parser_chunk_ptr chunk;
+	stmtid_t previous = _current;
+
+	while(_statement[_current].next == PARSER_END_STATEMENT
+			&& pipeline.next < pipeline.chunk.size()) {
+		chunk = &pipeline.chunk.at(pipeline.next);
+		slot = pipeline.next % pipeline.worker.size();
+		pipeline.worker_thread.at(slot).join();
+
+		if(chunk->error) {
+			_pipeline_end(pipeline);
+			std::rethrow_exception(chunk->error);
+		}
+
+		if(!chunk->complete) {
+			_skip_characters(chunk->begin);
+			_pipeline_end(pipeline);
+			break;
+		}
+		token_base = import_tokens(pipeline.worker.at(slot));
+		import_statements(chunk->statements, token_base);
+		std::vector<node>().swap(chunk->statements);
+
+		if((pipeline.next + pipeline.worker.size()) < pipeline.chunk.size()) {
+			_pipeline_launch(pipeline, pipeline.next + pipeline.worker.size());
+		}
+		++pipeline.next;
+	}
+
+	return _statement[previous].next;
+}
 
-			if(label_iter == _label_offset.end()) {
-				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-					ASSEMBLER_EXCEPTION_LABEL_UNDEFINED,
-					value_token.to_string(false)
-					);
-			}
-			result.push_back(label_iter->second);
-		} else {
+void 
+_assembler::_prefetch_includes(void)
+{
+	char ch;
+	std::vector<std::string> include;
+	size_t end, position = lexer_base::_position, subtype;
 
-			switch(value_token.get_subtype()) {
-				case VALUE_HEXIDECIMAL:
-				case VALUE_INTEGER:
-					value = 0;
-					result.push_back(0);
+	while(position < _input_size) {
+		ch = _input_data[position];
 
-					if(value_token.get_subtype() == VALUE_HEXIDECIMAL) {
-						radix = HEXIDECIMAL_RADIX;
-					}
+		if(ch == CHARACTER_COMMENT) {
+			position = _scan_line_end(position);
+		} else if(ch == CHARACTER_STRING_DELIMITOR) {
+			end = position + 1;
 
-					for(; i < value_token.get_text().size(); ++i) {
-						ch = value_token.get_text().at(i);
+			while(end < _input_size
+					&& _input_data[end] != CHARACTER_STRING_DELIMITOR
+					&& _input_data[end] != CHARACTER_END_STREAM) {
+				++end;
+			}
+			position = end + 1;
+		} else if(IS_CHARACTER_CLASS(ch, CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_DIGIT | CHARACTER_CLASS_UNDERSCORE)) {
+			end = _scan_character_class(position + 1, CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_DIGIT | CHARACTER_CLASS_UNDERSCORE);
+
+			if(IS_CHARACTER_CLASS(ch, CHARACTER_CLASS_DIGIT)
+					|| __determine_keyword(_input_data + position, end - position, subtype) != TOKEN_DIRECTIVE
+					|| subtype != DIRECTIVE_INCLUDE) {
+				position = end;
+				continue;
+			}
+			position = _scan_whitespace(end);
 
-						if(ch >= CHARACTER_HEXIDECIMAL_LOWER_0
-								&& ch <= CHARACTER_HEXIDECIMAL_LOWER_1) {
-							ch = (ch - CHARACTER_HEXIDECIMAL_LOWER_0) + HEXIDECIMAL_OFFSET;
-						} else if(ch >= CHARACTER_HEXIDECIMAL_UPPER_0
-								&& ch <= CHARACTER_HEXIDECIMAL_UPPER_1) {
-							ch = (ch - CHARACTER_HEXIDECIMAL_UPPER_0) + HEXIDECIMAL_OFFSET;
-						} else {
-							ch -= CHARACTER_ZERO;
-						}
-						value += ch * (size_t) std::pow(radix, value_token.get_text().size() - i - 1);
+			if(position >= _input_size
+					|| _input_data[position] != CHARACTER_STRING_DELIMITOR) {
+				continue;
+			}
 
-						if(value > MAX_WORD) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_VALUE_OUT_OR_RANGE,
-								value_token.to_string(false)
-								);
-						}
-					}
-					result.front() = (word_t) value;
-					break;
-				case VALUE_STRING_VAR:
+			for(end = position + 1; end < _input_size; ++end) {
 
-					for(ch_iter = value_token.get_text().begin(); ch_iter != value_token.get_text().end(); ++ch_iter) {
-						result.push_back((word_t) *ch_iter);
-					}
+				if(_input_data[end] == CHARACTER_STRING_DELIMITOR
+						|| _input_data[end] == CHARACTER_END_STREAM) {
 					break;
-				default:
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						value_token.to_string(false)
-						);
+				}
 			}
 
-			if(literal_value
-					&& (value_token.get_subtype() == VALUE_HEXIDECIMAL
-							|| value_token.get_subtype() == VALUE_INTEGER)
-					&& !result.empty()
-					&& (result.front() != MIN_LITERAL
-							&& result.front() > MAX_LITERAL)) {
-				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-					ASSEMBLER_EXCEPTION_LITERAL_VALUE_OUT_OR_RANGE,
-					value_token.to_string(false)
-					);
+			if(end < _input_size
+					&& _input_data[end] == CHARACTER_STRING_DELIMITOR) {
+				include.push_back(std::string(_input_data + position + 1, end - position - 1));
+				include.back().erase(std::remove(include.back().begin(), include.back().end(), CHARACTER_CARRIAGE_RETURN), 
+					include.back().end());
 			}
+			position = end + 1;
+		} else {
+			++position;
 		}
-		_value.insert(std::pair<uuidl_t, std::vector<word_t>>(value_token.get_id(), result));
-		value_iter = _value.find(value_token.get_id());
 	}
 
-	return value_iter->second;
+	if(!include.empty()) {
+		_include_cache.prefetch(get_origin_path(), include);
+	}
 }
 
 void 
-_assembler::_generate_pass_0(void)
+_assembler::_prefetch_includes(
+	stmtid_t statement
+	)
 {
-	word_t word;
-	uuidl_t bin_id;
-	node value_node;
-	word_t offset = 0;
-	parser inc_parser;
-	token tok, value_tok;
-	std::vector<word_t> value;
-	std::vector<node> statement;
-	std::string::iterator byte_iter;
-	std::map<std::string, word_t>::iterator label_iter;
-	size_t i, child_position, value_list_position, file_size;
-
-	parser::reset();
-	_label_offset.clear();
-	
-	while(has_next_statement()) {
-		value.clear();
-		statement = get_statement();
-		tok = get_token(statement.front().get_id());
-
-		switch(tok.get_type()) {
-			case TOKEN_BEGIN:
-				break;
-			case TOKEN_BASIC_OPCODE:
-			case TOKEN_SPECIAL_OPCODE:
-				++offset;
-
-				for(i = 0; i < statement.front().size(); ++i) {
-					child_position = statement.front().get_child_position(i);
+	token_view tok;
+	nodeid_t child;
+	std::vector<std::string> include;
+
+	for(; statement != PARSER_END_STATEMENT; statement = _statement[statement].next) {
+		tok = get_token_view(_node_pool[_statement[statement].begin].get_id());
+		child = _node_pool[_statement[statement].begin].get_first_child();
+
+		if(tok.get_type() == TOKEN_DIRECTIVE
+				&& tok.get_subtype() == DIRECTIVE_INCLUDE
+				&& child != INVALID_NODE_ID) {
+			tok = get_token_view(_node_pool[child].get_id());
+
+			if(tok.get_type() == TOKEN_VALUE
+					&& tok.get_subtype() == VALUE_STRING_VAR) {
+				include.push_back(tok.get_text());
+			}
+		}
+	}
 
-					if(child_position >= statement.size()) {
-						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-							tok.to_string(false)
-							);
-					}
-					tok = get_token(statement.at(child_position).get_id());
+	if(!include.empty()) {
+		_include_cache.prefetch(get_origin_path(), include);
+	}
+}
 
-					if(tok.get_type() != TOKEN_OPERAND) {
-						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-							tok.to_string(false)
-							);
-					}
+stmtid_t 
+_assembler::_relayout(void)
+{
+	symid_t label;
+	word_t offset = 0;
+	stmtid_t redefined = INVALID_STATEMENT_ID;
+	stmtid_t statement = _statement[PARSER_BEGIN_STATEMENT].next;
 
-					switch(tok.get_mode()) {
-						case ADDRESSING_MODE_REGISTER:
-						case ADDRESSING_MODE_INDIRECT_REGISTER:
-						case ADDRESSING_MODE_PUSH_POP:
-						case ADDRESSING_MODE_PEEK:
-						case ADDRESSING_MODE_SP_LITERAL:
-						case ADDRESSING_MODE_PC_LITERAL:
-						case ADDRESSING_MODE_EX_LITERAL:
-						case ADDRESSING_MODE_LITERAL:
-							break;
-						case ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD:
-						case ADDRESSING_MODE_PICK:
-						case ADDRESSING_MODE_INDIRECT_NEXT_WORD:
-						case ADDRESSING_MODE_NEXT_WORD_LITERAL:
-
-							if(tok.get_mode() == ADDRESSING_MODE_NEXT_WORD_LITERAL) {
-								value_node = statement.at(child_position);
-								
-								if(!value_node.size()) {
-									THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-										ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-										tok.to_string(false)
-										);
-								}
-								value_tok = get_token(statement.at(value_node.get_child_position(0)).get_id());
-
-								if(value_tok.get_type() != TOKEN_LABEL) {
-									value = _evaluate_value(value_tok, false);
-								
-									if(value.front() == MIN_LITERAL
-											|| value.front() <= MAX_LITERAL) {
-										get_token(statement.at(child_position).get_id()).set_mode(ADDRESSING_MODE_LITERAL);
-									} else {
-										++offset;
-									}
-								} else {
-									++offset;
-								}
-							} else {
-								++offset;
-							}
-							break;
-						default:
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-					}
-				}
-				break;
-			case TOKEN_DIRECTIVE:
-
-				switch(tok.get_subtype()) {
-					case DIRECTIVE_DATA:
-						if(!statement.front().has_children()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						value_list_position = statement.front().get_child_position(0);
+	_label_offset.assign(_label_offset.size(), INVALID_TYPE);
 
-						for(i = 0; i < statement.at(value_list_position).size(); ++i) {
-							child_position = statement.at(value_list_position).get_child_position(i);
+	for(; statement != PARSER_END_STATEMENT; statement = _statement[statement].next) {
+		_layout[statement].offset = offset;
+		label = _layout[statement].label;
 
-							if(child_position >= statement.size()) {
-								THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-									ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-									tok.to_string(false)
-									);
-							}
-							tok = get_token(statement.at(child_position).get_id());
+		if(label != INVALID_SYMBOL_ID) {
 
-							if(tok.get_type() == TOKEN_LABEL) {
-								++offset;
-							} else {
+			if(label >= _label_offset.size()) {
+				_label_offset.resize(label + 1, INVALID_TYPE);
+			}
 
-								switch(tok.get_subtype()) {
-									case VALUE_HEXIDECIMAL:
-									case VALUE_INTEGER:
-										++offset;
-										break;
-									case VALUE_STRING_VAR:
-										offset += (word_t) tok.get_text().size();
-										break;
-									default:
-										THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-											ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-											tok.to_string(false)
-											);
-								}
-							}
-						}
-						break;
-					case DIRECTIVE_INCBIN: {
-						bin_id = tok.get_id();
-						child_position = statement.front().get_child_position(0);
-
-						if(child_position >= statement.size()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						tok = get_token(statement.at(child_position).get_id());
-						
-						if(tok.get_type() != TOKEN_VALUE
-								|| tok.get_subtype() != VALUE_STRING_VAR) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						std::ifstream file(
-							std::string(get_origin_path() + tok.get_text()).c_str(), 
-							std::ios::in | std::ios::binary
-							);
+			if(_label_offset[label] == INVALID_TYPE) {
+				_label_offset[label] = offset;
+			} else if(redefined == INVALID_STATEMENT_ID) {
+				redefined = statement;
+			}
+		}
+		offset += _layout[statement].size;
+	}
 
-						if(!file) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_INCLUDE_FILE_NOT_FOUND,
-								"\'" << tok.get_text() << "\'"
-								);
-						}
-						file_size = (size_t) file.tellg();
-						file.seekg(0, std::ios::end);
-						file_size = (size_t) file.tellg() - file_size;
-						file.seekg(0, std::ios::beg);
-
-						if(file_size % 2) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_BINARY_FILE_UNALIGNED,
-								"\'" << tok.get_text() << "\'"
-								);
-						}
+	return redefined;
+}
 
-						while(file.peek() != EOF) {
-							file.read((char *) &word, sizeof(word_t));
-							value.push_back((word << BYTE_WIDTH) | (word >> BYTE_WIDTH));
-						}
-						file.close();
-						offset += (word_t) value.size();
-
-						if(offset > MAX_WORD) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_BINARY_FILE_TOO_LARGE,
-								"\'" << tok.get_text() << "\'"
-								);
-						}
-						_binary_include.insert(std::pair<uuidl_t, std::vector<word_t>>(bin_id, value));
-						} break;
-					case DIRECTIVE_INCLUDE:
-						child_position = statement.front().get_child_position(0);
-
-						if(child_position >= statement.size()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						tok = get_token(statement.at(child_position).get_id());
-
-						if(tok.get_type() != TOKEN_VALUE
-								|| tok.get_subtype() != VALUE_STRING_VAR) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						remove_statement();
-						inc_parser = parser(get_origin_path() + tok.get_text(), true);
-						inc_parser.discover();
-						import_tokens(inc_parser.export_tokens());
-						import_statements(inc_parser.export_statements());
-						break;
-					case DIRECTIVE_RESERVE:
-						child_position = statement.front().get_child_position(0);
-
-						if(child_position >= statement.size()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						tok = get_token(statement.at(child_position).get_id());
-
-						if(tok.get_type() != TOKEN_VALUE
-								|| tok.get_subtype() != VALUE_INTEGER) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						offset += _evaluate_value(tok).front();
+void 
+_assembler::_settle_layout(
+	stmtid_t statement,
+	word_t delta
+	)
+{
+	symid_t label;
 
-						if(offset > MAX_WORD) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_RESERVATION_TOO_LARGE,
-								tok.to_string(false)
-								);
-						}
-						break;
-					default:
-						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-							tok.to_string(false)
-							);
-				}
-				break;
-			case TOKEN_LABEL:
-				label_iter = _label_offset.find(tok.get_text());
+	for(; delta && (statement != PARSER_END_STATEMENT); statement = _statement[statement].next) {
+		_layout[statement].offset += delta;
+		label = _layout[statement].label;
 
-				if(label_iter != _label_offset.end()) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_LABEL_REDEFINITION,
-						tok.to_string(false)
-						);
-				}
-				_label_offset.insert(std::pair<std::string, word_t>(tok.get_text(), offset));
-				break;
-			default:
-				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-					tok.to_string(false)
-					);
+		if(label != INVALID_SYMBOL_ID) {
+			_label_offset[label] = _layout[statement].offset;
 		}
-		move_next_statement();
 	}
 }
 
-void 
-_assembler::_generate_pass_1(void)
+stmtid_t 
+_assembler::_statement_at_line(
+	size_t line
+	)
 {
-	token tok;
-	std::vector<node> statement;
-	std::vector<word_t> result, oper_a, oper_b;
-	size_t i, child_position, value_list_position;
-	std::map<std::string, word_t>::iterator label_iter;
-	std::map<uuidl_t, std::vector<word_t>>::iterator bin_include_iter;
-
-	parser::reset();
-	_binary_file.clear();
-
-	while(has_next_statement()) {
-		statement = get_statement();
-		tok = get_token(statement.front().get_id());
+	stmtid_t result = PARSER_END_STATEMENT;
 
-		switch(tok.get_type()) {
-			case TOKEN_BEGIN:
-			case TOKEN_LABEL:
-				break;
-			case TOKEN_BASIC_OPCODE:
+	for(; line < _line_statement.size(); ++line) {
 
-				if(statement.front().size() != OPCODE_BASIC_OPERAND_COUNT) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						tok.to_string(false)
-						);
-				}
-				oper_b = _evaluate_operand(statement, statement.front().get_child_position(0));
-				oper_a = _evaluate_operand(statement, statement.front().get_child_position(1));
-				_binary_file.push_back(DEFINE_OPCODE_BASIC(OPCODE_BASIC_VALUE(tok.get_subtype()), oper_a.front(), oper_b.front()));
+		if(_line_statement[line] != INVALID_STATEMENT_ID) {
+			result = _line_statement[line];
+			break;
+		}
+	}
 
-				if(oper_a.size() > 1) {
-					_binary_file.push_back(oper_a.back());
-				}
+	return result;
+}
 
-				if(oper_b.size() > 1) {
-					_binary_file.push_back(oper_b.back());
-				}
-				break;
-			case TOKEN_DIRECTIVE:
-
-				switch(tok.get_subtype()) {
-					case DIRECTIVE_DATA:
-						if(!statement.front().has_children()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						value_list_position = statement.front().get_child_position(0);
+size_t 
+_assembler::_statement_line(
+	stmtid_t statement
+	)
+{
+	return _token.get_line(_layout[statement].anchor);
+}
 
-						for(i = 0; i < statement.at(value_list_position).size(); ++i) {
-							child_position = statement.at(value_list_position).get_child_position(i);
+size_t 
+_assembler::_statement_line_end(
+	stmtid_t statement
+	)
+{
+	token_view tok;
+	std::string text;
+	size_t line, result = 0;
+	nodeid_t id = _statement[statement].begin;
 
-							if(child_position >= statement.size()) {
-								THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-									ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-									tok.to_string(false)
-									);
-							}
-							tok = get_token(statement.at(child_position).get_id());
+	if(_layout[statement].spliced) {
+		return _statement_line(statement) + _layout[statement].span;
+	}
 
-							if(tok.get_type() == TOKEN_LABEL) {
-								label_iter = _label_offset.find(tok.get_text());
+	for(; id < _statement[statement].end; ++id) {
+		tok = get_token_view(_node_pool[id].get_id());
+		line = tok.get_line();
 
-								if(label_iter == _label_offset.end()) {
-									THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-										ASSEMBLER_EXCEPTION_LABEL_UNDEFINED,
-										tok.to_string(false)
-										);
-								}
-								_binary_file.push_back(label_iter->second);
-							} else {
+		if(line != INVALID_TYPE
+				&& tok.get_type() == TOKEN_VALUE
+				&& tok.get_subtype() == VALUE_STRING_VAR) {
+			text = tok.get_text();
+			line += std::count(text.begin(), text.end(), CHARACTER_NEWLINE);
+		}
 
-								switch(tok.get_subtype()) {
-									case VALUE_HEXIDECIMAL:
-									case VALUE_INTEGER:
-									case VALUE_STRING_VAR:
-										result = _evaluate_value(tok, false);
-										_binary_file.insert(_binary_file.end(), result.begin(), result.end());
-										break;
-									default:
-										THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-											ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-											tok.to_string(false)
-											);
-								}
-							}
-						}
-						break;
-					case DIRECTIVE_INCBIN:
-						bin_include_iter = _binary_include.find(tok.get_id());
-
-						if(bin_include_iter == _binary_include.end()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						_binary_file.insert(_binary_file.end(), bin_include_iter->second.begin(), bin_include_iter->second.end());
-						break;
-					case DIRECTIVE_RESERVE:
-						child_position = statement.front().get_child_position(0);
-
-						if(child_position >= statement.size()) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						tok = get_token(statement.at(child_position).get_id());
-
-						if(tok.get_type() != TOKEN_VALUE
-								|| tok.get_subtype() != VALUE_INTEGER) {
-							THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-								ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-								tok.to_string(false)
-								);
-						}
-						result = _evaluate_value(tok);
+		if(line != INVALID_TYPE
+				&& line > result) {
+			result = line;
+		}
+	}
 
-						for(i = 0; i < result.front(); ++i) {
-							_binary_file.push_back(ASSEMBLER_RESERVED_VALUE);
-						}
-						break;
-					default:
-						THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-							ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-							tok.to_string(false)
-							);
-				}
-				break;
-			case TOKEN_SPECIAL_OPCODE:
+	return result;
+}
 
-				if(statement.front().size() != OPCODE_SPECIAL_OPERAND_COUNT) {
-					THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-						ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-						tok.to_string(false)
-						);
-				}
-				oper_a = _evaluate_operand(statement, statement.front().get_child_position(0));
-				_binary_file.push_back(DEFINE_OPCODE_SPECIAL(OPCODE_SPECIAL_VALUE(tok.get_subtype()), oper_a.front()));
+word_t 
+_assembler::_resolve_label(
+	token_view &label_token
+	)
+{
+	symid_t symbol = label_token.get_symbol();
 
-				if(oper_a.size() > 1) {
-					_binary_file.push_back(oper_a.back());
-				}
-				break;
-			default:
-				THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
-					ASSEMBLER_EXCEPTION_MALFORMED_STATEMENT,
-					tok.to_string(false)
-					);
-		}
-		move_next_statement();
+	if(symbol >= _label_offset.size()
+			|| _label_offset[symbol] == INVALID_TYPE) {
+		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+			ASSEMBLER_EXCEPTION_LABEL_UNDEFINED,
+			label_token.to_string(false)
+			);
 	}
+
+	return (word_t) _label_offset[symbol];
 }
 
 void 
@@ -793,13 +1222,18 @@ _assembler::_write_file(
 void 
 _assembler::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
-	parser::reset();
+	parser::clear();
 	_binary_file.clear();
 	_binary_include.clear();
+	_edit_dirty = false;
+	_label_conflict = false;
 	_label_offset.clear();
-	_value.clear();
+	_layout.clear();
+	_layout_valid = false;
+	_line_statement.clear();
+	_pass_count = 0;
 }
 
 void 
@@ -808,19 +1242,23 @@ _assembler::generate(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	try {
 		
 		if(verbose) {
 			std::cout << "Building source file(s)... pass 1... ";
 		}
-		_generate_pass_0();
+		_pass_count = 1;
 
-		if(verbose) {
-			std::cout << "pass 2... ";
+		if(!_generate_pass_0(true)) {
+			++_pass_count;
+
+			if(verbose) {
+				std::cout << "pass 2... ";
+			}
+			_generate_pass_1();
 		}
-		_generate_pass_1();
 
 		if(verbose) {
 			std::cout << "Done." << std::endl;
@@ -843,18 +1281,173 @@ _assembler::generate(
 	}
 }
 
+void 
+_assembler::edit(
+	size_t position,
+	size_t length,
+	const std::string &text
+	)
+{
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
+
+	long delta;
+	symid_t label;
+	parser region;
+	token_view tok;
+	tokid_t token_base;
+	word_t begin_offset, offset, size = 0;
+	std::vector<node> statements;
+	std::vector<token> tokens;
+	size_t begin, end, first, hint = 0, last, line_count;
+	stmtid_t following, next, previous, redefined = INVALID_STATEMENT_ID, statement;
+
+	if(!_layout_valid) {
+		lexer::replace_input(position, length, text);
+		_edit_dirty = true;
+		_generate_pass_0();
+		return;
+	}
+	first = _input->get_line(position, hint);
+	last = _input->get_line(position + length, hint);
+	statement = _statement_at_line(first);
+	previous = _statement[statement].previous;
+
+	while(previous != PARSER_BEGIN_STATEMENT
+			&& (_statement_line(previous) >= first
+			|| _statement_line_end(previous) >= first
+			|| _is_label_statement(statement))) {
+		first = std::min(first, _statement_line(previous));
+		statement = previous;
+		previous = _statement[previous].previous;
+	}
+
+	if(previous == PARSER_BEGIN_STATEMENT) {
+		first = 0;
+		offset = 0;
+	} else {
+		offset = _layout[previous].offset + _layout[previous].size;
+	}
+	begin_offset = offset;
+	next = statement;
+
+	while(next != PARSER_END_STATEMENT
+			&& (_statement_line(next) <= last
+			|| _is_label_statement(next))) {
+		last = std::max(last, _statement_line_end(next));
+		size += _layout[next].size;
+		label = _layout[next].label;
+
+		if(label != INVALID_SYMBOL_ID) {
+			_label_offset[label] = INVALID_TYPE;
+		}
+		next = _statement[next].next;
+	}
+	line_count = _input->get_line_count();
+
+	if(_line_statement.size() < line_count) {
+		_line_statement.resize(line_count, INVALID_STATEMENT_ID);
+	}
+	lexer::replace_input(position, length, text);
+	delta = (long) _input->get_line_count() - (long) line_count;
+	_token.shift_lines(_origin, last + 1, delta);
+	_line_statement.erase(_line_statement.begin() + first, _line_statement.begin() 
+		+ std::min(last + 1, _line_statement.size()));
+	last += delta;
+	_line_statement.insert(_line_statement.begin() + first, (last + 1) - first, INVALID_STATEMENT_ID);
+	statement = _statement[previous].next;
+
+	while(statement != next) {
+		following = _statement[statement].next;
+		_unlink_statement(statement);
+		statement = following;
+	}
+
+	try {
+		begin = _input->get_line_position(first);
+		end = ((last + 1) < _input->get_line_count()) ? _input->get_line_position(last + 1) : _input_size;
+		region.initialize(*this, begin, end);
+		region.discover();
+		tokens = region.export_tokens();
+		statements = region.export_statements();
+		token_base = import_tokens(tokens, _origin);
+		_current = previous;
+		_position = 0;
+		import_statements(statements, token_base);
+		move_next_statement();
+
+		while(_current != next) {
+			statement = _layout_statement(offset);
+
+			if(statement != INVALID_STATEMENT_ID
+					&& _layout[statement].label != INVALID_SYMBOL_ID) {
+				label = _layout[statement].label;
+
+				if(label >= _label_offset.size()) {
+					_label_offset.resize(label + 1, INVALID_TYPE);
+				}
+
+				if(_label_offset[label] != INVALID_TYPE) {
+					_label_conflict = true;
+				} else {
+					_label_offset[label] = _layout[statement].offset;
+				}
+			}
+			move_next_statement();
+		}
+	} catch(std::runtime_error &) {
+		_edit_dirty = true;
+	}
+
+	if(_edit_dirty) {
+		_generate_pass_0();
+		return;
+	}
+	parser::reset();
+
+	if(_label_conflict) {
+		redefined = _relayout();
+		_label_conflict = (redefined != INVALID_STATEMENT_ID);
+	} else {
+		_settle_layout(next, (word_t) ((offset - begin_offset) - size));
+	}
+
+	if(redefined != INVALID_STATEMENT_ID) {
+		tok = get_token_view(_node_pool[_statement[redefined].begin].get_id());
+		THROW_ASSEMBLER_EXCEPTION_WITH_MESSAGE(
+			ASSEMBLER_EXCEPTION_LABEL_REDEFINITION,
+			tok.to_string(false)
+			);
+	}
+}
+
 std::vector<word_t> &
 _assembler::get_binary_data(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	return _binary_file;
 }
 
+include_cache &
+_assembler::get_include_cache(void)
+{
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
+
+	return _include_cache;
+}
+
+size_t 
+_assembler::get_pass_count(void)
+{
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
+
+	return _pass_count;
+}
+
 bool 
 _assembler::has_binary_data(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	return !_binary_file.empty();
 }
@@ -865,7 +1458,7 @@ _assembler::initialize(
 	bool is_file
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	parser::initialize(input, is_file);
 	clear();
@@ -876,19 +1469,25 @@ _assembler::initialize(
 	const _assembler &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	parser::initialize(other);
 	_binary_file = other._binary_file;
 	_binary_include = other._binary_include;
+	_edit_dirty = other._edit_dirty;
+	_include_cache = other._include_cache;
+	_label_conflict = other._label_conflict;
 	_label_offset = other._label_offset;
-	_value = other._value;
+	_layout = other._layout;
+	_layout_valid = other._layout_valid;
+	_line_statement = other._line_statement;
+	_pass_count = other._pass_count;
 }
 
 size_t 
 _assembler::size(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	return _binary_file.size() * sizeof(word_t);
 }
@@ -898,7 +1497,7 @@ _assembler::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _assembler_lock);
+	LOCK_OBJECT(object_lock_t, _assembler_lock);
 
 	word_t i = 0;
 	std::stringstream ss;
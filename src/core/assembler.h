@@ -20,9 +20,39 @@
 #ifndef ASSEMBLER_H_
 #define ASSEMBLER_H_
 
+#include <thread>
+#include <unordered_map>
+#include "include_cache.h"
 #include "parser.h"
 #include "type.h"
 
+typedef struct _assembler_fixup_t {
+	size_t position;
+	stmtid_t statement;
+} assembler_fixup_t, *assembler_fixup_ptr;
+
+typedef struct _assembler_layout_t {
+	tokid_t anchor;
+	symid_t label;
+	word_t offset;
+	word_t size;
+	size_t span;
+	bool spliced;
+} assembler_layout_t, *assembler_layout_ptr;
+
+typedef struct _assembler_operand_t {
+	word_t next_word;
+	bool has_next_word;
+	word_t value;
+} assembler_operand_t, *assembler_operand_ptr;
+
+typedef struct _assembler_pipeline_t {
+	std::vector<parser_chunk_t> chunk;
+	size_t next;
+	std::vector<parser> worker;
+	std::vector<std::thread> worker_thread;
+} assembler_pipeline_t, *assembler_pipeline_ptr;
+
 typedef class _assembler :
 		public parser {
 
@@ -47,6 +77,12 @@ typedef class _assembler :
 
 		virtual void clear(void);
 
+		void edit(
+			size_t position,
+			size_t length,
+			const std::string &text
+			);
+
 		virtual void generate(
 			const std::string &output,
 			bool verbose
@@ -54,6 +90,10 @@ typedef class _assembler :
 
 		std::vector<word_t> &get_binary_data(void);
 
+		include_cache &get_include_cache(void);
+
+		size_t get_pass_count(void);
+
 		bool has_binary_data(void);
 
 		virtual void initialize(
@@ -73,35 +113,115 @@ typedef class _assembler :
 
 	protected:
 
-		std::vector<word_t> &_evaluate_operand(
-			std::vector<node> &statement,
-			size_t position
+		void _define_label(
+			token_view &label_token,
+			word_t offset
 			);
 
-		std::vector<word_t> &_evaluate_value(
-			token &value_token,
+		void _encode_statement(
+			nodeid_t statement
+			);
+
+		assembler_operand_t _evaluate_operand(
+			nodeid_t operand
+			);
+
+		word_t _evaluate_value(
+			token_view &value_token,
 			bool literal_value = false
 			);
 
-		void _generate_pass_0(void);
+		bool _generate_pass_0(
+			bool encode = false
+			);
 
 		void _generate_pass_1(void);
 
+		bool _has_undefined_label(
+			stmtid_t statement
+			);
+
+		bool _is_label_statement(
+			stmtid_t statement
+			);
+
+		stmtid_t _layout_statement(
+			word_t &offset
+			);
+
+		bool _pipeline_begin(
+			assembler_pipeline_t &pipeline
+			);
+
+		void _pipeline_end(
+			assembler_pipeline_t &pipeline
+			);
+
+		void _pipeline_launch(
+			assembler_pipeline_t &pipeline,
+			size_t chunk
+			);
+
+		stmtid_t _pipeline_next(
+			assembler_pipeline_t &pipeline
+			);
+
+		void _prefetch_includes(void);
+
+		void _prefetch_includes(
+			stmtid_t statement
+			);
+
+		stmtid_t _relayout(void);
+
+		word_t _resolve_label(
+			token_view &label_token
+			);
+
+		void _settle_layout(
+			stmtid_t statement,
+			word_t delta
+			);
+
+		stmtid_t _statement_at_line(
+			size_t line
+			);
+
+		size_t _statement_line(
+			stmtid_t statement
+			);
+
+		size_t _statement_line_end(
+			stmtid_t statement
+			);
+
 		void _write_file(
 			const std::string &output
 			);
 
 		std::vector<word_t> _binary_file;
 
-		std::map<uuidl_t, std::vector<word_t>> _binary_include;
+		std::unordered_map<tokid_t, std::vector<word_t>> _binary_include;
+
+		bool _edit_dirty;
+
+		include_cache _include_cache;
+
+		bool _label_conflict;
+
+		std::vector<size_t> _label_offset;
+
+		std::vector<assembler_layout_t> _layout;
+
+		bool _layout_valid;
 
-		std::map<std::string, word_t> _label_offset;
+		std::vector<stmtid_t> _line_statement;
 
-		std::map<uuidl_t, std::vector<word_t>> _value;
+		size_t _pass_count;
 
 	private:
 
-		std::recursive_mutex _assembler_lock;
+		object_lock_t _assembler_lock;
 
 } assembler, *assembler_ptr;
 
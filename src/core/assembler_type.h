@@ -58,9 +58,6 @@ static const std::string ASSEMBLER_EXCEPTION_STR[] = {
 #define ASSEMBLER_RESERVED_VALUE (0)
 #define BINARY_BLOCK_WIDTH (8)
 #define BINARY_FILE_EXTENSION ".bin"
-#define HEXIDECIMAL_RADIX (16)
-#define HEXIDECIMAL_OFFSET (10)
-#define INTEGER_RADIX (10)
 #define MAX_ASSEMBLER_EXCEPTION ASSEMBLER_EXCEPTION_WRITE_FILE_FAILED
 #define SHOW_ASSEMBLER_EXCEPTION_HEADER true
 
@@ -27,12 +27,12 @@
 namespace dasm16 {
 
 static bool __dasm_initialized = false;
-static std::recursive_mutex __dasm16_lock;
+static object_lock_t __dasm16_lock;
 
 void 
 initialize(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, __dasm16_lock);
+	LOCK_OBJECT(object_lock_t, __dasm16_lock);
 
 	uuid::initialize();
 	__dasm_initialized = true;
@@ -45,7 +45,7 @@ invoke_assembler(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, __dasm16_lock);
+	LOCK_OBJECT(object_lock_t, __dasm16_lock);
 
 	if(!__dasm_initialized) {
 		THROW_DASM16_EXCEPTION(DASM16_EXCEPTION_NOT_INITIALIZED);
@@ -64,7 +64,7 @@ invoke_assembler(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, __dasm16_lock);
+	LOCK_OBJECT(object_lock_t, __dasm16_lock);
 
 	if(!__dasm_initialized) {
 		THROW_DASM16_EXCEPTION(DASM16_EXCEPTION_NOT_INITIALIZED);
@@ -82,7 +82,7 @@ version(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, __dasm16_lock);
+	LOCK_OBJECT(object_lock_t, __dasm16_lock);
 
 	std::stringstream ss;
 
@@ -0,0 +1,420 @@
+/*
+ * include_cache.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <cstdlib>
+#include <set>
+#include "include_cache.h"
+#include "include_cache_type.h"
+#include "lang_def.h"
+#include "parser.h"
+
+_include_cache::_include_cache(void) :
+	_pool_entry(NULL),
+	_pool_generation(0),
+	_pool_next(0),
+	_pool_pending(0),
+	_pool_stop(false)
+{
+	clear();
+}
+
+_include_cache::_include_cache(
+	const _include_cache &other
+	) :
+		_hit_count(other._hit_count),
+		_miss_count(other._miss_count),
+		_pool_entry(NULL),
+		_pool_generation(0),
+		_pool_next(0),
+		_pool_pending(0),
+		_pool_stop(false),
+		_unit(other._unit)
+{
+	return;
+}
+
+_include_cache::~_include_cache(void)
+{
+	_join_pool();
+}
+
+_include_cache &
+_include_cache::operator=(
+	const _include_cache &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	if(this != &other) {
+		_hit_count = other._hit_count;
+		_miss_count = other._miss_count;
+		_unit = other._unit;
+	}
+
+	return *this;
+}
+
+std::string 
+_include_cache::_identify_unit(
+	const std::string &path,
+	size_t &length,
+	uint64_t &modified
+	)
+{
+	std::string result;
+#ifdef _WIN32
+	DWORD path_length;
+	WIN32_FILE_ATTRIBUTE_DATA status;
+
+	path_length = GetFullPathNameA(path.c_str(), 0, NULL, NULL);
+
+	if(!path_length
+			|| !GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &status)) {
+		THROW_INCLUDE_CACHE_EXCEPTION_WITH_MESSAGE(
+			INCLUDE_CACHE_EXCEPTION_FILE_NOT_FOUND,
+			"\'" << path << "\'"
+			);
+	}
+	result.resize(path_length);
+	result.resize(GetFullPathNameA(path.c_str(), path_length, &result[0], NULL));
+	length = (size_t) ((((uint64_t) status.nFileSizeHigh) << 0x20) | status.nFileSizeLow);
+	modified = (((uint64_t) status.ftLastWriteTime.dwHighDateTime) << 0x20) | status.ftLastWriteTime.dwLowDateTime;
+#else
+	char *canonical;
+	struct stat status;
+
+	canonical = realpath(path.c_str(), NULL);
+
+	if(!canonical) {
+		THROW_INCLUDE_CACHE_EXCEPTION_WITH_MESSAGE(
+			INCLUDE_CACHE_EXCEPTION_FILE_NOT_FOUND,
+			"\'" << path << "\'"
+			);
+	}
+	result = canonical;
+	free(canonical);
+
+	if(stat(result.c_str(), &status)) {
+		THROW_INCLUDE_CACHE_EXCEPTION_WITH_MESSAGE(
+			INCLUDE_CACHE_EXCEPTION_FILE_NOT_FOUND,
+			"\'" << path << "\'"
+			);
+	}
+	length = (size_t) status.st_size;
+#ifdef __APPLE__
+	modified = ((uint64_t) status.st_mtimespec.tv_sec * 1000000000ULL) + status.st_mtimespec.tv_nsec;
+#else
+	modified = ((uint64_t) status.st_mtim.tv_sec * 1000000000ULL) + status.st_mtim.tv_nsec;
+#endif
+#endif
+
+	return result;
+}
+
+void 
+_include_cache::_join_pool(void)
+{
+	size_t iter = 0;
+
+	{
+		LOCK_OBJECT(std::mutex, _pool_lock);
+
+		_pool_stop = true;
+	}
+	_pool_signal.notify_all();
+
+	for(; iter < _pool_thread.size(); ++iter) {
+		_pool_thread.at(iter).join();
+	}
+	_pool_thread.clear();
+	_pool_stop = false;
+}
+
+void 
+_include_cache::_parse_unit(
+	const std::string &path,
+	include_unit_t &unit
+	)
+{
+	parser unit_parser(path, true);
+
+	unit_parser.discover();
+	unit.statements = unit_parser.export_statements();
+	unit.tokens = unit_parser.export_tokens();
+}
+
+void 
+_include_cache::_pool_worker(
+	size_t generation
+	)
+{
+	std::unique_lock<std::mutex> lock(_pool_lock);
+
+	for(;;) {
+
+		while(!_pool_stop
+				&& (generation == _pool_generation)) {
+			_pool_signal.wait(lock);
+		}
+
+		if(_pool_stop) {
+			break;
+		}
+		generation = _pool_generation;
+		lock.unlock();
+		_prefetch_worker(*_pool_entry, _pool_next);
+		lock.lock();
+
+		if(!--_pool_pending) {
+			_pool_complete.notify_all();
+		}
+	}
+}
+
+void 
+_include_cache::_prefetch_units(
+	std::vector<include_prefetch_t> &entry
+	)
+{
+	bool dispatched = false;
+	std::unique_lock<std::mutex> lock(_pool_lock);
+
+	_pool_next = 0;
+
+	if(std::min(THREAD_COUNT(), entry.size()) > 1) {
+
+		while(_pool_thread.size() < (THREAD_COUNT() - 1)) {
+			_pool_thread.push_back(std::thread(&_include_cache::_pool_worker, this, _pool_generation));
+		}
+		_pool_entry = &entry;
+		_pool_pending = _pool_thread.size();
+		++_pool_generation;
+		dispatched = true;
+		_pool_signal.notify_all();
+	}
+	lock.unlock();
+	_prefetch_worker(entry, _pool_next);
+
+	if(dispatched) {
+		lock.lock();
+
+		while(_pool_pending) {
+			_pool_complete.wait(lock);
+		}
+	}
+}
+
+void 
+_include_cache::_prefetch_worker(
+	std::vector<include_prefetch_t> &entry,
+	std::atomic<size_t> &next
+	)
+{
+	uint64_t modified;
+	size_t length, position = next++;
+	include_prefetch_ptr current;
+	std::unordered_map<std::string, include_unit_t>::iterator unit_iter;
+
+	for(; position < entry.size(); position = next++) {
+		current = &entry.at(position);
+
+		try {
+			current->key = _identify_unit(current->path, length, modified);
+			unit_iter = _unit.find(current->key);
+			current->cached = (unit_iter != _unit.end()
+					&& unit_iter->second.length == length
+					&& unit_iter->second.modified == modified);
+
+			if(!current->cached) {
+				_parse_unit(current->path, current->unit);
+				current->unit.length = length;
+				current->unit.modified = modified;
+			}
+			current->loaded = true;
+		} catch(...) {
+			current->loaded = false;
+		}
+	}
+}
+
+void 
+_include_cache::_scan_unit(
+	include_unit_t &unit,
+	std::vector<std::string> &include
+	)
+{
+	token_ptr tok;
+	std::vector<node>::iterator node_iter = unit.statements.begin();
+
+	for(; node_iter != unit.statements.end(); ++node_iter) {
+
+		if(node_iter->has_parent()
+				|| !node_iter->has_children()) {
+			continue;
+		}
+		tok = &unit.tokens.at(node_iter->get_id());
+
+		if(tok->get_type() != TOKEN_DIRECTIVE
+				|| tok->get_subtype() != DIRECTIVE_INCLUDE) {
+			continue;
+		}
+		tok = &unit.tokens.at(unit.statements.at(node_iter->get_first_child()).get_id());
+
+		if(tok->get_type() == TOKEN_VALUE
+				&& tok->get_subtype() == VALUE_STRING_VAR) {
+			include.push_back(tok->get_text());
+		}
+	}
+}
+
+void 
+_include_cache::clear(void)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	_hit_count = 0;
+	_miss_count = 0;
+	_unit.clear();
+}
+
+size_t 
+_include_cache::get_hit_count(void)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	return _hit_count;
+}
+
+size_t 
+_include_cache::get_miss_count(void)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	return _miss_count;
+}
+
+include_unit_t &
+_include_cache::load(
+	const std::string &path
+	)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	size_t length;
+	uint64_t modified;
+	std::string key;
+	include_unit_t unit;
+	std::unordered_map<std::string, include_unit_t>::iterator unit_iter;
+
+	key = _identify_unit(path, length, modified);
+	unit_iter = _unit.find(key);
+
+	if(unit_iter != _unit.end()
+			&& unit_iter->second.length == length
+			&& unit_iter->second.modified == modified) {
+		++_hit_count;
+	} else {
+		++_miss_count;
+		_parse_unit(path, unit);
+		unit.length = length;
+		unit.modified = modified;
+		_unit[key] = unit;
+		unit_iter = _unit.find(key);
+	}
+
+	return unit_iter->second;
+}
+
+void 
+_include_cache::prefetch(
+	const std::string &base,
+	const std::vector<std::string> &include
+	)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	std::string path;
+	std::set<std::string> visited;
+	std::vector<include_prefetch_t> entry;
+	std::vector<std::string> next = include;
+	std::vector<std::string>::iterator include_iter;
+	std::vector<include_prefetch_t>::iterator entry_iter;
+
+	while(!next.empty()) {
+		entry.clear();
+
+		for(include_iter = next.begin(); include_iter != next.end(); ++include_iter) {
+			path = base + *include_iter;
+
+			if(visited.insert(path).second) {
+				entry.push_back(include_prefetch_t());
+				entry.back().path = path;
+			}
+		}
+		next.clear();
+		_prefetch_units(entry);
+
+		for(entry_iter = entry.begin(); entry_iter != entry.end(); ++entry_iter) {
+
+			if(!entry_iter->loaded) {
+				continue;
+			}
+
+			if(!entry_iter->cached) {
+				++_miss_count;
+				std::swap(_unit[entry_iter->key], entry_iter->unit);
+			}
+			_scan_unit(_unit[entry_iter->key], next);
+		}
+	}
+}
+
+size_t 
+_include_cache::size(void)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	return _unit.size();
+}
+
+std::string 
+_include_cache::to_string(
+	bool verbose
+	)
+{
+	LOCK_OBJECT(object_lock_t, _include_cache_lock);
+
+	std::stringstream ss;
+
+	ss << "(" << _unit.size() << " units";
+
+	if(verbose) {
+		ss << ", " << _hit_count << " hits, " << _miss_count << " misses";
+	}
+	ss << ")";
+
+	return ss.str();
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+ * include_cache.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INCLUDE_CACHE_H_
+#define INCLUDE_CACHE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "node.h"
+#include "token.h"
+#include "type.h"
+
+typedef struct _include_unit_t {
+	size_t length;
+	uint64_t modified;
+	std::vector<node> statements;
+	std::vector<token> tokens;
+} include_unit_t, *include_unit_ptr;
+
+typedef struct _include_prefetch_t {
+	bool cached;
+	std::string key;
+	bool loaded;
+	std::string path;
+	include_unit_t unit;
+} include_prefetch_t, *include_prefetch_ptr;
+
+typedef class _include_cache {
+
+	public:
+
+		_include_cache(void);
+
+		_include_cache(
+			const _include_cache &other
+			);
+
+		virtual ~_include_cache(void);
+
+		_include_cache &operator=(
+			const _include_cache &other
+			);
+
+		virtual void clear(void);
+
+		size_t get_hit_count(void);
+
+		size_t get_miss_count(void);
+
+		include_unit_t &load(
+			const std::string &path
+			);
+
+		void prefetch(
+			const std::string &base,
+			const std::vector<std::string> &include
+			);
+
+		virtual size_t size(void);
+
+		virtual std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		static std::string _identify_unit(
+			const std::string &path,
+			size_t &length,
+			uint64_t &modified
+			);
+
+		void _join_pool(void);
+
+		void _parse_unit(
+			const std::string &path,
+			include_unit_t &unit
+			);
+
+		void _pool_worker(
+			size_t generation
+			);
+
+		void _prefetch_units(
+			std::vector<include_prefetch_t> &entry
+			);
+
+		void _prefetch_worker(
+			std::vector<include_prefetch_t> &entry,
+			std::atomic<size_t> &next
+			);
+
+		static void _scan_unit(
+			include_unit_t &unit,
+			std::vector<std::string> &include
+			);
+
+		size_t _hit_count;
+
+		size_t _miss_count;
+
+		std::condition_variable _pool_complete;
+
+		std::vector<include_prefetch_t> *_pool_entry;
+
+		size_t _pool_generation;
+
+		std::mutex _pool_lock;
+
+		std::atomic<size_t> _pool_next;
+
+		size_t _pool_pending;
+
+		std::condition_variable _pool_signal;
+
+		bool _pool_stop;
+
+		std::vector<std::thread> _pool_thread;
+
+		std::unordered_map<std::string, include_unit_t> _unit;
+
+	private:
+
+		object_lock_t _include_cache_lock;
+
+} include_cache, *include_cache_ptr;
+
+#endif
\ No newline at end of file
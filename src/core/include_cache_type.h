@@ -0,0 +1,47 @@
+/*
+ * include_cache_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INCLUDE_CACHE_TYPE_H_
+#define INCLUDE_CACHE_TYPE_H_
+
+#include "type.h"
+
+enum {
+	INCLUDE_CACHE_EXCEPTION_FILE_NOT_FOUND = 0,
+};
+
+static const std::string INCLUDE_CACHE_EXCEPTION_STR[] = {
+	"File not found",
+};
+
+#define MAX_INCLUDE_CACHE_EXCEPTION INCLUDE_CACHE_EXCEPTION_FILE_NOT_FOUND
+#define SHOW_INCLUDE_CACHE_EXCEPTION_HEADER true
+#define INCLUDE_CACHE_EXCEPTION_HEADER "INCLUDE_CACHE"
+
+#define INCLUDE_CACHE_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_INCLUDE_CACHE_EXCEPTION ? UNKNOWN_EXCEPTION : INCLUDE_CACHE_EXCEPTION_STR[_T_])
+#define THROW_INCLUDE_CACHE_EXCEPTION(_T_)\
+	THROW_EXCEPTION(INCLUDE_CACHE_EXCEPTION_HEADER, INCLUDE_CACHE_EXCEPTION_STRING(_T_), SHOW_INCLUDE_CACHE_EXCEPTION_HEADER)
+#define THROW_INCLUDE_CACHE_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(INCLUDE_CACHE_EXCEPTION_HEADER, INCLUDE_CACHE_EXCEPTION_STRING(_T_), _M_, SHOW_INCLUDE_CACHE_EXCEPTION_HEADER)
+
+class _include_cache;
+typedef _include_cache include_cache, *include_cache_ptr;
+
+#endif
\ No newline at end of file
@@ -20,31 +20,51 @@
 #include "lang_def.h"
 
 size_t 
-__determine_token_subtype(
-	const std::string &text,
-	size_t type
+__determine_keyword(
+	const char *text,
+	size_t length,
+	size_t &subtype
 	)
 {
-	std::string *subtypes = NULL;
-	size_t i = 0, result = TOKEN_TYPE_LENGTH(type);
+	size_t i = 0;
+	const keyword_t *keyword;
 
-	if(result > 0) {
-		subtypes = (std::string *) TOKEN_TYPE_STRING(type);
+	subtype = INVALID_TYPE;
 
-		if(subtypes) {
+	if(!length
+			|| length > KEYWORD_MAX_LENGTH) {
+		return TOKEN_LABEL;
+	}
+	keyword = &KEYWORD_HASH[KEYWORD_HASH_VALUE(text, length)];
+
+	if(keyword->length != length) {
+		return TOKEN_LABEL;
+	}
+
+	for(; i < length; ++i) {
+
+		if(KEYWORD_CHARACTER(text[i]) != (size_t) keyword->text[i]) {
+			return TOKEN_LABEL;
+		}
+	}
+	subtype = keyword->subtype;
+
+	return keyword->type;
+}
+
+size_t 
+__determine_symbol_subtype(
+	char ch
+	)
+{
+	size_t i = 0, result = INVALID_TYPE;
 
-			for(; i < result; ++i) {
+	for(; i <= MAX_SYMBOL; ++i) {
 
-				if(text == subtypes[i]) {
-					result = i;
-					break;
-				}
-			}
-		} else {
-			result = INVALID_TYPE;
+		if(ch == SYMBOL_CH[i]) {
+			result = i;
+			break;
 		}
-	} else {
-		result = INVALID_TYPE;
 	}
 
 	return result;
@@ -20,7 +20,6 @@
 #ifndef LANG_DEF_H_
 #define LANG_DEF_H_
 
-#include <set>
 #include "type.h"
 
 enum {
@@ -46,8 +45,7 @@ enum {
 };
 
 enum {
-	OPCODE_BASIC_RESERVED = 0,
-	OPCODE_BASIC_SET_CMD,
+	OPCODE_BASIC_SET_CMD = 0,
 	OPCODE_BASIC_ADD,
 	OPCODE_BASIC_SUB,
 	OPCODE_BASIC_MUL,
@@ -77,8 +75,7 @@ enum {
 };
 
 enum {
-	OPCODE_SPECIAL_RESERVED = 0,
-	OPCODE_SPECIAL_JSR,
+	OPCODE_SPECIAL_JSR = 0,
 	OPCODE_SPECIAL_INT,
 	OPCODE_SPECIAL_IAG,
 	OPCODE_SPECIAL_IAS,
@@ -214,6 +211,9 @@ static const std::string VALUE_STR[] = {
 	"HEXIDECIMAL", "INTEGER", "STRING",
 };
 
+#define KEYWORD_CHARACTER_FOLD (0xdf)
+#define KEYWORD_HASH_LENGTH (0x80)
+#define KEYWORD_MAX_LENGTH (7)
 #define MAX_LITERAL ((word_t) 0x1e)
 #define MAX_ADDRESSING_MODE ADDRESSING_MODE_LITERAL
 #define MAX_DIRECTIVE DIRECTIVE_RESERVE
@@ -242,61 +242,154 @@ static const std::string *TOKEN_TYPE_STR[] = {
 	OPCODE_SPECIAL_STR, SYMBOL_STR, SYSTEM_REGISTER_STR, VALUE_STR, NULL,
 };
 
-static const std::set<std::string> DIRECTIVE_SET(
-	DIRECTIVE_STR,
-	DIRECTIVE_STR + MAX_DIRECTIVE + 1
-	);
-
-static const std::set<std::string> OPCODE_BASIC_SET(
-	OPCODE_BASIC_STR,
-	OPCODE_BASIC_STR + MAX_OPCODE_BASIC + 1
-	);
-
-static const std::set<std::string> OPCODE_SPECIAL_SET(
-	OPCODE_SPECIAL_STR,
-	OPCODE_SPECIAL_STR + MAX_OPCODE_SPECIAL + 1
-	);
-
-static const std::set<std::string> OPERATOR_SET(
-	OPERATOR_STR,
-	OPERATOR_STR + MAX_OPERATOR + 1
-	);
-
-static const std::set<std::string> REGISTER_SET(
-	REGISTER_STR,
-	REGISTER_STR + MAX_REGISTER + 1
-	);
-
-static const std::set<char> SYMBOL_CH_SET(
-	SYMBOL_CH,
-	SYMBOL_CH + MAX_SYMBOL + 1
-	);
-
-static const std::set<std::string> SYMBOL_STR_SET(
-	SYMBOL_STR,
-	SYMBOL_STR + MAX_SYMBOL + 1
-	);
-
-static const std::set<std::string> SYSTEM_REGISTER_SET(
-	SYSTEM_REGISTER_STR,
-	SYSTEM_REGISTER_STR + MAX_SYSTEM_REGISTER + 1
-	);
+typedef struct _keyword_t {
+	const char *text;
+	size_t length;
+	size_t type;
+	size_t subtype;
+} keyword_t, *keyword_ptr;
+
+static const keyword_t KEYWORD_HASH[KEYWORD_HASH_LENGTH] = {
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "INCBIN", 6, TOKEN_DIRECTIVE, DIRECTIVE_INCBIN },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "JSR", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_JSR },
+	{ "INCLUDE", 7, TOKEN_DIRECTIVE, DIRECTIVE_INCLUDE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "MLI", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_MLI },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "IAG", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_IAG },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "ADD", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_ADD },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "STD", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_STD },
+	{ "MOD", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_MOD },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "SUB", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_SUB },
+	{ "IAQ", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_IAQ },
+	{ "STI", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_STI },
+	{ "IAS", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_IAS },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "A", 1, TOKEN_REGISTER, REGISTER_A },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "IFA", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFA },
+	{ "IFB", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFB },
+	{ "IFC", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFC },
+	{ "DVI", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_DVI },
+	{ "IFE", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFE },
+	{ "ADX", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_ADX },
+	{ "IFG", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFG },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "PEEK", 4, TOKEN_OPERATOR, OPERATOR_PEEK },
+	{ "IFL", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFL },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "IFN", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFN },
+	{ "I", 1, TOKEN_REGISTER, REGISTER_I },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "B", 1, TOKEN_REGISTER, REGISTER_B },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "IFU", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_IFU },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "MUL", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_MUL },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "X", 1, TOKEN_REGISTER, REGISTER_X },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "PICK", 4, TOKEN_OPERATOR, OPERATOR_PICK },
+	{ "EX", 2, TOKEN_SYSTEM_REGISTER, SYSTEM_REGISTER_EX },
+	{ "J", 1, TOKEN_REGISTER, REGISTER_J },
+	{ "RFI", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_RFI },
+	{ "C", 1, TOKEN_REGISTER, REGISTER_C },
+	{ "AND", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_AND },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "DAT", 3, TOKEN_DIRECTIVE, DIRECTIVE_DATA },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "SBX", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_SBX },
+	{ "Y", 1, TOKEN_REGISTER, REGISTER_Y },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "POP", 3, TOKEN_OPERATOR, OPERATOR_POP },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "SET", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_SET_CMD },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "INT", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_INT },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "XOR", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_XOR },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "SHL", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_SHL },
+	{ "Z", 1, TOKEN_REGISTER, REGISTER_Z },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "MDI", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_MDI },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "SHR", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_SHR },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "BOR", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_BOR },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "ASR", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_ASR },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "HWI", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_HWI },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "DIV", 3, TOKEN_BASIC_OPCODE, OPCODE_BASIC_DIV },
+	{ "RESERVE", 7, TOKEN_DIRECTIVE, DIRECTIVE_RESERVE },
+	{ "HWN", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_HWN },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "HWQ", 3, TOKEN_SPECIAL_OPCODE, OPCODE_SPECIAL_HWQ },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "PUSH", 4, TOKEN_OPERATOR, OPERATOR_PUSH },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "IA", 2, TOKEN_SYSTEM_REGISTER, SYSTEM_REGISTER_IA },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ NULL, 0, TOKEN_LABEL, INVALID_TYPE },
+	{ "PC", 2, TOKEN_SYSTEM_REGISTER, SYSTEM_REGISTER_PC },
+	{ "SP", 2, TOKEN_SYSTEM_REGISTER, SYSTEM_REGISTER_SP },
+};
 
-#define TO_UPPERCASE(_S_) TRANSFORM(::toupper, _S_)
+#define KEYWORD_CHARACTER(_C_) ((size_t) ((byte_t) (_C_) & KEYWORD_CHARACTER_FOLD))
+#define KEYWORD_HASH_VALUE(_T_, _L_)\
+	((((_L_) * 0xe) + (KEYWORD_CHARACTER((_T_)[0]) * 0x11) + KEYWORD_CHARACTER((_T_)[(_L_) - 1])\
+	+ ((_L_) > 1 ? KEYWORD_CHARACTER((_T_)[1]) * 0x5 : 0)) & (KEYWORD_HASH_LENGTH - 1))
 #define ADDRESSING_MODE_STRING(_T_) (_T_ > MAX_ADDRESSING_MODE ? UNKNOWN : ADDRESSING_MODE_STR[_T_])
 #define ADDRESSING_MODE_VALUE(_T_) (_T_ > MAX_ADDRESSING_MODE ? INVALID_WORD : ADDRESSING_MODE_VAL[_T_])
 #define DEFINE_OPCODE_BASIC(_OP_, _A_, _B_)\
 	((word_t) (((word_t) _A_ & 0x3f) << 0xa) | (((word_t) _B_ & 0x1f) << 0x5) | ((word_t) _OP_ & 0x1f))
 #define DEFINE_OPCODE_SPECIAL(_OP_, _A_)\
 	((word_t) (((word_t) _A_ & 0x3f) << 0xa) | (((word_t) _OP_ & 0x1f) << 0x5))
-#define IS_DIRECTIVE(_S_) (DIRECTIVE_SET.find(_S_) != DIRECTIVE_SET.end())
-#define IS_OPCODE_BASIC(_S_) (OPCODE_BASIC_SET.find(_S_) != OPCODE_BASIC_SET.end())
-#define IS_OPCODE_SPECIAL(_S_) (OPCODE_SPECIAL_SET.find(_S_) != OPCODE_SPECIAL_SET.end())
-#define IS_OPERATOR(_S_) (OPERATOR_SET.find(_S_) != OPERATOR_SET.end())
-#define IS_REGISTER(_S_) (REGISTER_SET.find(_S_) != REGISTER_SET.end())
-#define IS_SYMBOL_CHARACTER(_C_) (SYMBOL_CH_SET.find(_C_) != SYMBOL_CH_SET.end())
-#define IS_SYMBOL_TYPE(_S_) (SYMBOL_STR_SET.find(_S_) != SYMBOL_STR_SET.end())
-#define IS_SYSTEM_REGISTER(_S_) (SYSTEM_REGISTER_SET.find(_S_) != SYSTEM_REGISTER_SET.end())
 #define DIRECTIVE_STRING(_T_) (_T_ > MAX_DIRECTIVE ? UNKNOWN : DIRECTIVE_STR[_T_])
 #define OPCODE_BASIC_STRING(_T_) (_T_ > MAX_OPCODE_BASIC ? UNKNOWN : OPCODE_BASIC_STR[_T_])
 #define OPCODE_BASIC_VALUE(_T_) (_T_ > MAX_OPCODE_BASIC ? INVALID_WORD : OPCODE_BASIC_VAL[_T_])
@@ -311,9 +404,14 @@ static const std::set<std::string> SYSTEM_REGISTER_SET(
 #define TOKEN_TYPE_STRING(_T_) (_T_ > MAX_TOKEN ? NULL : TOKEN_TYPE_STR[_T_])
 #define VALUE_STRING(_T_) (_T_ > MAX_VALUE ? UNKNOWN : VALUE_STR[_T_])
 
-size_t __determine_token_subtype(
-	const std::string &text,
-	size_t type
+size_t __determine_keyword(
+	const char *text,
+	size_t length,
+	size_t &subtype
+	);
+
+size_t __determine_symbol_subtype(
+	char ch
 	);
 
 #endif
\ No newline at end of file
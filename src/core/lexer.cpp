@@ -17,6 +17,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
+#include <thread>
+#include <unordered_map>
 #include "lang_def.h"
 #include "lexer.h"
 #include "lexer_base_type.h"
@@ -52,7 +55,7 @@ _lexer::operator=(
 	const _lexer &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	if(this != &other) {
 		initialize(other);
@@ -82,59 +85,144 @@ _lexer::_advance_character(
 	move_next_character();
 }
 
+void 
+_lexer::_discover_parallel(void)
+{
+	size_t begin = lexer_base::_position, count, end, iter, position;
+	std::vector<lexer_chunk_t> chunk;
+	std::vector<lexer_boundary_t> boundary;
+	std::vector<lexer> worker;
+	std::vector<std::thread> worker_thread;
+	std::vector<token>::iterator token_iter;
+	const char *end_stream;
+
+	if(_position != (_token_position.size() - 2)
+			|| begin >= _input_size) {
+		return;
+	}
+	end_stream = (const char *) memchr(_input_data + begin, CHARACTER_END_STREAM, _input_size - begin);
+	end = end_stream ? (end_stream - _input_data) : _input_size;
+	count = std::min(THREAD_COUNT(), (end - begin) / LEXER_CHUNK_LENGTH_MIN);
+
+	if(count < 2) {
+		return;
+	}
+	boundary = _split_chunks(end, count);
+	count = boundary.size() - 1;
+
+	if(count < 2) {
+		return;
+	}
+	chunk.resize(count);
+	worker.resize(count);
+
+	for(iter = 0; iter < count; ++iter) {
+		chunk.at(iter).begin = boundary.at(iter).position;
+		chunk.at(iter).end = boundary.at(iter + 1).position;
+		chunk.at(iter).position = chunk.at(iter).begin;
+		chunk.at(iter).complete = false;
+		worker.at(iter).lexer_base::initialize(*this);
+
+		if(iter) {
+			worker.at(iter)._set_line(boundary.at(iter).line, boundary.at(iter).position);
+		}
+	}
+
+	for(iter = 1; iter < count; ++iter) {
+		worker_thread.push_back(std::thread(&_lexer::_enumerate_chunk, &worker.at(iter), std::ref(chunk.at(iter))));
+	}
+	worker.front()._enumerate_chunk(chunk.front());
+
+	for(iter = 0; iter < worker_thread.size(); ++iter) {
+		worker_thread.at(iter).join();
+	}
+
+	for(iter = 0; iter < count; ++iter) {
+
+		if(chunk.at(iter).error) {
+			std::rethrow_exception(chunk.at(iter).error);
+		}
+	}
+	position = begin;
+
+	for(iter = 0; iter < count; ++iter) {
+
+		for(token_iter = chunk.at(iter).result.begin(); token_iter != chunk.at(iter).result.end(); ++token_iter) {
+			_token_position.insert(_token_position.end() - 1, _store_token(*token_iter, _origin));
+		}
+		position = chunk.at(iter).position;
+
+		if(!chunk.at(iter).complete) {
+			break;
+		}
+	}
+	_skip_characters(position);
+}
+
 void 
 _lexer::_enumerate_alpha_token(
 	token &tok
 	)
 {
-	char ch;
-	size_t type;
+	size_t begin = lexer_base::_position, end, position, subtype;
 
 	tok.clear();
 
-	if(get_character_type() != CHARACTER_ALPHA
-			&& get_character() != CHARACTER_UNDERSCORE) {
+	if(!IS_CHARACTER_CLASS(get_character(), CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_UNDERSCORE)) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 			LEXER_EXCEPTION_EXPECTED_ALPHA_CHARACTER,
 			lexer_base::to_string(false)
 			);
 	}
-	tok.get_text() += get_character();
-	_advance_character();
+	end = _scan_character_class(begin + 1, CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_DIGIT | CHARACTER_CLASS_UNDERSCORE);
+	_skip_characters(end);
+	tok.set_type(__determine_keyword(_input_data + begin, end - begin, subtype));
 
-	while(has_next_character()) {
-		ch = get_character();
-		type = get_character_type();
+	if(tok.get_type() == TOKEN_LABEL) {
 
-		if(type != CHARACTER_ALPHA
-				&& type != CHARACTER_DIGIT
-				&& ch != CHARACTER_UNDERSCORE) {
-			break;
+		for(position = begin; position < end; ++position) {
+
+			if(IS_CHARACTER_CLASS(_input_data[position], CHARACTER_CLASS_LOWERCASE)) {
+				break;
+			}
+		}
+
+		if(position < end) {
+			tok.set_text(std::string(_input_data + begin, end - begin));
+			TRANSFORM(::toupper, tok.get_text());
+		} else {
+			tok.set_text_view(_input_data + begin, end - begin);
 		}
-		tok.get_text() += ch;
-		_advance_character();
-	}
-	TO_UPPERCASE(tok.get_text());
-
-	if(IS_DIRECTIVE(tok.get_text())) {
-		tok.set_type(TOKEN_DIRECTIVE);
-	} else if(IS_OPCODE_BASIC(tok.get_text())) {
-		tok.set_type(TOKEN_BASIC_OPCODE);
-	} else if(IS_OPCODE_SPECIAL(tok.get_text())) {
-		tok.set_type(TOKEN_SPECIAL_OPCODE);
-	} else if(IS_OPERATOR(tok.get_text())) {
-		tok.set_type(TOKEN_OPERATOR);
-	} else if(IS_REGISTER(tok.get_text())) {
-		tok.set_type(TOKEN_REGISTER);
-	} else if(IS_SYSTEM_REGISTER(tok.get_text())) {
-		tok.set_type(TOKEN_SYSTEM_REGISTER);
 	} else {
-		tok.set_type(TOKEN_LABEL);
+		tok.set_subtype(subtype);
 	}
+}
 
-	if(tok.get_type() != TOKEN_LABEL) {
-		tok.set_subtype(__determine_token_subtype(tok.get_text(), tok.get_type()));
-		tok.get_text().clear();
+void 
+_lexer::_enumerate_chunk(
+	lexer_chunk_t &chunk
+	)
+{
+
+	try {
+		_skip_characters(chunk.begin);
+		_skip_whitespace();
+
+		while(lexer_base::_position < chunk.end) {
+			token tok;
+
+			chunk.position = lexer_base::_position;
+			_enumerate_token(tok);
+			chunk.result.push_back(tok);
+			_skip_whitespace();
+		}
+		chunk.position = chunk.end;
+		chunk.complete = true;
+	} catch(std::runtime_error &) {
+		chunk.complete = false;
+	} catch(...) {
+		chunk.complete = false;
+		chunk.error = std::current_exception();
 	}
 }
 
@@ -144,6 +232,8 @@ _lexer::_enumerate_digit_token(
 	)
 {
 	char ch;
+	size_t begin = lexer_base::_position, end, position, radix = INTEGER_RADIX, value = 0;
+
 	tok.clear();
 	tok.set_type(TOKEN_VALUE);
 
@@ -154,14 +244,13 @@ _lexer::_enumerate_digit_token(
 			);
 	}
 	ch = get_character();
-	tok.get_text() += get_character();
 	_advance_character();
 
 	if(ch == CHARACTER_ZERO
 			&& (get_character() == CHARACTER_HEXIDECIMAL_DELIMITOR_LOWER
 					|| get_character() == CHARACTER_HEXIDECIMAL_DELIMITOR_UPPER)) {
 		tok.set_subtype(VALUE_HEXIDECIMAL);
-		tok.get_text().clear();
+		radix = HEXIDECIMAL_RADIX;
 		_advance_character();
 
 		if(!IS_VALUE_TYPE(get_character())) {
@@ -170,21 +259,24 @@ _lexer::_enumerate_digit_token(
 				lexer_base::to_string(false)
 				);
 		}
+		begin = lexer_base::_position;
+		end = _scan_character_class(begin, CHARACTER_CLASS_HEXIDECIMAL);
 	} else {
 		tok.set_subtype(VALUE_INTEGER);
+		end = _scan_character_class(lexer_base::_position, CHARACTER_CLASS_DIGIT);
 	}
 
-	while(has_next_character()) {
-		ch = get_character();
+	for(position = begin; position < end; ++position) {
+		value = (value * radix) + HEXIDECIMAL_CHARACTER_VALUE(_input_data[position]);
 
-		if(!IS_VALUE_TYPE(ch)
-				|| (tok.get_subtype() == VALUE_INTEGER 
-						&& IS_HEXIDECIMAL_CHARACTER(ch))) {
+		if(value > MAX_WORD) {
+			value = MAX_WORD + 1;
 			break;
 		}
-		tok.get_text() += ch;
-		_advance_character();
 	}
+	tok.set_text_view(_input_data + begin, end - begin);
+	tok.set_value(value);
+	_skip_characters(end);
 }
 
 void 
@@ -193,7 +285,8 @@ _lexer::_enumerate_symbol_token(
 	)
 {
 	char ch;
-	size_t position;
+	bool carriage_return;
+	size_t begin, end, position;
 
 	tok.clear();
 
@@ -210,44 +303,44 @@ _lexer::_enumerate_symbol_token(
 			tok.set_type(TOKEN_VALUE);
 			tok.set_subtype(VALUE_STRING_VAR);
 			position = get_character_position();
+			begin = position + 1;
+			end = begin;
 
-			if(!has_next_character()) {
-				THROW_LEXER_EXCEPTION_WITH_MESSAGE(
-					LEXER_EXCEPTION_UNTERMINATED_STRING_LITERAL,
-					"pos. " << position
-					);
-			}
-			_advance_character();
-
-			while(has_next_character()) {
-				ch = get_character();
+			carriage_return = false;
 
-				if(ch == CHARACTER_STRING_DELIMITOR) {
-					break;
-				}
-				tok.get_text() += ch;
-				_advance_character();
+			while(end < _input_size
+					&& _input_data[end] != CHARACTER_STRING_DELIMITOR
+					&& _input_data[end] != CHARACTER_END_STREAM) {
+				carriage_return |= (_input_data[end] == CHARACTER_CARRIAGE_RETURN);
+				++end;
 			}
 
-			if(!has_next_character()
-					&& ch != CHARACTER_STRING_DELIMITOR) {
+			if(end == _input_size
+					|| _input_data[end] != CHARACTER_STRING_DELIMITOR) {
 				THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 					LEXER_EXCEPTION_UNTERMINATED_STRING_LITERAL,
 					"pos. " << position
 					);
 			}
-			_advance_character();
+
+			if(carriage_return) {
+				std::string text(_input_data + begin, end - begin);
+
+				text.erase(std::remove(text.begin(), text.end(), CHARACTER_CARRIAGE_RETURN), text.end());
+				tok.set_text(text);
+			} else {
+				tok.set_text_view(_input_data + begin, end - begin);
+			}
+			_skip_characters(end + 1);
 			break;
 		case CHARACTER_UNDERSCORE:
 			_enumerate_alpha_token(tok);
 			break;
 		default:
 
-			if(IS_SYMBOL_CHARACTER(ch)) {
+			if(IS_CHARACTER_CLASS(ch, CHARACTER_CLASS_SYMBOL)) {
 				tok.set_type(TOKEN_SYMBOL);
-				tok.get_text() += get_character();
-				tok.set_subtype(__determine_token_subtype(tok.get_text(), tok.get_type()));
-				tok.get_text().clear();
+				tok.set_subtype(__determine_symbol_subtype(ch));
 				_advance_character();
 			} else {
 				THROW_LEXER_EXCEPTION_WITH_MESSAGE(
@@ -260,55 +353,189 @@ _lexer::_enumerate_symbol_token(
 }
 
 void 
-_lexer::_skip_whitespace(void)
+_lexer::_enumerate_token(
+	token &tok
+	)
 {
-	while(has_next_character()) {
+	size_t line = get_character_row(), type = get_character_type();
 
-		if(get_character_type() != CHARACTER_WHITESPACE) {
+	switch(type) {
+		case CHARACTER_ALPHA:
+			_enumerate_alpha_token(tok);
 			break;
-		}
-		move_next_character();
+		case CHARACTER_DIGIT:
+			_enumerate_digit_token(tok);
+			break;
+		case CHARACTER_SYMBOL:
+			_enumerate_symbol_token(tok);
+			break;
+		default:
+			THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+				LEXER_EXCEPTION_INVALID_TOKEN_TYPE,
+				"type. " << type
+				);
 	}
+	tok.set_line(line);
+}
 
-	if(has_next_character()
-			&& get_character_type() == CHARACTER_SYMBOL
-			&& get_character() == CHARACTER_COMMENT) {
+std::vector<tokid_t> 
+_lexer::_export_index(void)
+{
+	size_t position;
+	std::vector<tokid_t> result(_token.size(), INVALID_TOKEN_ID), order = _export_order();
 
-		while(has_next_character()) {
+	for(position = 0; position < order.size(); ++position) {
+		result.at(order.at(position)) = (tokid_t) position;
+	}
 
-			if(get_character_type() == CHARACTER_WHITESPACE
-					&& get_character() == CHARACTER_NEWLINE) {
-				break;
+	return result;
+}
+
+std::vector<tokid_t> 
+_lexer::_export_order(void)
+{
+	tokid_t id;
+	size_t position, type;
+	std::vector<tokid_t> result;
+	std::vector<size_t>::iterator splice_iter;
+	std::unordered_map<tokid_t, std::vector<size_t>> anchor;
+	std::vector<tokid_t>::iterator token_pos_iter = _token_position.begin();
+	std::unordered_map<tokid_t, std::vector<size_t>>::iterator anchor_iter;
+
+	for(position = 0; position < _token_splice.size(); ++position) {
+		anchor[_token_splice.at(position).anchor].push_back(position);
+	}
+	result.reserve(_token.size());
+
+	for(; token_pos_iter != _token_position.end(); ++token_pos_iter) {
+
+		if(!anchor.empty()) {
+			anchor_iter = anchor.find(*token_pos_iter);
+
+			if(anchor_iter != anchor.end()) {
+
+				for(splice_iter = anchor_iter->second.begin(); splice_iter != anchor_iter->second.end(); ++splice_iter) {
+
+					for(id = _token_splice.at(*splice_iter).begin; id < _token_splice.at(*splice_iter).end; ++id) {
+						result.push_back(id);
+					}
+				}
 			}
-			move_next_character();
 		}
-		_skip_whitespace();
+		type = _token.get_type(*token_pos_iter);
+
+		if(type == TOKEN_BEGIN
+				|| type == TOKEN_END) {
+			continue;
+		}
+		result.push_back(*token_pos_iter);
 	}
+
+	return result;
+}
+
+void 
+_lexer::_skip_whitespace(void)
+{
+	size_t position = _scan_whitespace(lexer_base::_position);
+
+	while(position < _input_size
+			&& IS_CHARACTER_CLASS(_input_data[position], CHARACTER_CLASS_COMMENT)) {
+		position = _scan_whitespace(_scan_line_end(position));
+	}
+	_skip_characters(position);
+}
+
+std::vector<lexer_boundary_t> 
+_lexer::_split_chunks(
+	size_t end,
+	size_t count
+	)
+{
+	char ch;
+	bool comment = false, literal = false;
+	std::vector<lexer_boundary_t> result;
+	lexer_boundary_t boundary = { get_character_row(), lexer_base::_position };
+	size_t length = (end - boundary.position) / count, position = boundary.position, 
+		target = boundary.position + length;
+
+	result.push_back(boundary);
+
+	for(; position < end && result.size() < count; ++position) {
+		ch = _input_data[position];
+
+		if(literal) {
+			literal = (ch != CHARACTER_STRING_DELIMITOR);
+		} else if(comment) {
+			comment = (ch != CHARACTER_NEWLINE);
+		} else if(ch == CHARACTER_STRING_DELIMITOR) {
+			literal = true;
+		} else if(ch == CHARACTER_COMMENT) {
+			comment = true;
+		}
+
+		if(ch != CHARACTER_NEWLINE) {
+			continue;
+		}
+		++boundary.line;
+
+		if(!literal
+				&& position >= target) {
+			boundary.position = position + 1;
+			result.push_back(boundary);
+			target = boundary.position + length;
+		}
+	}
+
+	if(result.back().position < end) {
+		boundary.position = end;
+		result.push_back(boundary);
+	}
+
+	return result;
+}
+
+tokid_t 
+_lexer::_store_token(
+	token &tok
+	)
+{
+	return _token.append(tok);
+}
+
+tokid_t 
+_lexer::_store_token(
+	token &tok,
+	const std::string &origin
+	)
+{
+	return _token.append(tok, origin);
 }
 
 void 
 _lexer::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	token begin_tok(TOKEN_BEGIN), end_tok(TOKEN_END);
 
 	lexer_base::reset();
 	_position = 0;
 	_token.clear();
+	_token.set_source(_input_data);
 	_token_position.clear();
-	_token.insert(std::pair<uuidl_t, token>(begin_tok.get_id(), begin_tok));
-	_token.insert(std::pair<uuidl_t, token>(end_tok.get_id(), end_tok));
-	_token_position.push_back(begin_tok.get_id());
-	_token_position.push_back(end_tok.get_id());
+	_token_position.push_back(_store_token(begin_tok));
+	_token_position.push_back(_store_token(end_tok));
+	_token_splice.clear();
 }
 
 void 
 _lexer::discover(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	clear();
+	_discover_parallel();
 
 	while(has_next_token()) {
 		move_next_token();
@@ -319,132 +546,231 @@ _lexer::discover(void)
 std::vector<token> 
 _lexer::export_tokens(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	token tok;
 	std::vector<token> result;
-	std::vector<uuidl_t>::iterator token_pos_iter = _token_position.begin();
+	std::vector<tokid_t> order = _export_order();
+	std::vector<tokid_t>::iterator order_iter = order.begin();
 
-	for(; token_pos_iter != _token_position.end(); ++token_pos_iter) {
-		tok = _token.find(*token_pos_iter)->second;
+	result.reserve(order.size());
 
-		if(tok.get_type() == TOKEN_BEGIN
-				|| tok.get_type() == TOKEN_END) {
-			continue;
-		}
+	for(; order_iter != order.end(); ++order_iter) {
+		tok = _token.get(*order_iter);
+		tok.own_text();
+		tok.set_id((tokid_t) result.size());
 		result.push_back(tok);
 	}
 
 	return result;
 }
 
-uuidl_t 
+tokid_t 
 _lexer::get_begin_token_id(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	return _token_position.front();
 }
 
-uuidl_t 
+tokid_t 
 _lexer::get_end_token_id(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	return _token_position.back();
 }
 
-token &
+token 
 _lexer::get_token(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
-
-	std::map<uuidl_t, token>::iterator token_iter;
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	if(_position >= _token.size()) {
+	if(_position >= _token_position.size()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 			LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
 			"pos. " << _position
 			);
 	}
-	token_iter = _token.find(_token_position.at(_position));
 
-	if(token_iter == _token.end()) {
+	return get_token(_token_position.at(_position));
+}
+
+token 
+_lexer::get_token(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	if(id >= _token.size()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 			LEXER_EXCEPTION_TOKEN_NOT_FOUND,
-			"{" << LONG_ID_AS_STRING(_token_position.at(_position)) << "}"
+			"{" << id << "}"
 			);
 	}
 
-	return token_iter->second;
+	return _token.get(id);
 }
 
-token &
-_lexer::get_token(
-	uuidl_t id
-	)
+size_t 
+_lexer::get_token_position(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	std::map<uuidl_t, token>::iterator token_iter = _token.find(id);
+	return _position;
+}
+
+symid_t 
+_lexer::get_token_symbol(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	if(token_iter == _token.end()) {
+	if(id >= _token.size()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 			LEXER_EXCEPTION_TOKEN_NOT_FOUND,
-			"{" << LONG_ID_AS_STRING(id) << "}"
+			"{" << id << "}"
 			);
 	}
 
-	return token_iter->second;
+	return _token.get_symbol(id);
 }
 
 size_t 
-_lexer::get_token_position(void)
+_lexer::get_token_type(
+	tokid_t id
+	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	return _position;
+	if(id >= _token.size()) {
+		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+			LEXER_EXCEPTION_TOKEN_NOT_FOUND,
+			"{" << id << "}"
+			);
+	}
+
+	return _token.get_type(id);
+}
+
+token_view 
+_lexer::get_token_view(void)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	if(_position >= _token_position.size()) {
+		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+			LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
+			"pos. " << _position
+			);
+	}
+
+	return token_view(&_token, _token_position[_position]);
+}
+
+token_view 
+_lexer::get_token_view(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	if(id >= _token.size()) {
+		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+			LEXER_EXCEPTION_TOKEN_NOT_FOUND,
+			"{" << id << "}"
+			);
+	}
+
+	return token_view(&_token, id);
 }
 
 bool 
 _lexer::has_token(
-	uuidl_t id
+	tokid_t id
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	return _token.find(id) != _token.end();
+	return id < _token.size();
 }
 
 bool 
 _lexer::has_next_token(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	if(_position >= _token_position.size()) {
+		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+			LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
+			"pos. " << _position
+			);
+	}
 
-	return get_token().get_type() != TOKEN_END;
+	return get_token_type(_token_position.at(_position)) != TOKEN_END;
 }
 
 bool 
 _lexer::has_previous_token(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	return _position > 0;
 }
 
-void 
+tokid_t 
 _lexer::import_tokens(
-	std::vector<token> tokens
+	const std::vector<token> &tokens,
+	const std::string &origin
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	token tok;
+	lexer_splice_t splice;
+	std::vector<token>::const_iterator token_iter = tokens.begin();
 
-	std::vector<token>::iterator token_iter = tokens.begin();
+	splice.anchor = _token_position.at(_position);
+	splice.begin = (tokid_t) _token.size();
 
 	for(; token_iter != tokens.end(); ++token_iter) {
-		_token.insert(std::pair<uuidl_t, token>(token_iter->get_id(), *token_iter));
-		_token_position.insert(_token_position.begin() + (_position++), token_iter->get_id());
+		tok = *token_iter;
+
+		if(tok.has_origin()) {
+			_store_token(tok, origin);
+		} else {
+			_store_token(tok);
+		}
+	}
+	splice.end = (tokid_t) _token.size();
+
+	if(splice.begin != splice.end) {
+		_token_splice.push_back(splice);
 	}
+
+	return splice.begin;
+}
+
+tokid_t 
+_lexer::import_tokens(
+	_lexer &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	lexer_splice_t splice;
+
+	splice.anchor = _token_position.at(_position);
+	splice.begin = _token.append(other._token, other._export_order());
+	splice.end = (tokid_t) _token.size();
+
+	if(splice.begin != splice.end) {
+		_token_splice.push_back(splice);
+	}
+
+	return splice.begin;
 }
 
 void 
@@ -453,10 +779,11 @@ _lexer::initialize(
 	bool is_file
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	lexer_base::initialize(input, is_file);
 	clear();
+	_token.set_source(_input_data);
 }
 
 void 
@@ -464,39 +791,54 @@ _lexer::initialize(
 	const _lexer &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	lexer_base::initialize(other);
 	_position = other._position;
 	_token = other._token;
 	_token_position = other._token_position;
+	_token_splice = other._token_splice;
+}
+
+void 
+_lexer::initialize(
+	const _lexer_base &other,
+	size_t begin,
+	size_t end
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	lexer_base::initialize(other, begin, end);
+	clear();
+	_token.set_source(_input_data);
 }
 
-uuidl_t  
+tokid_t 
 _lexer::insert_token(
 	token &tok
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	return insert_token(tok, _position);
 }
 
-uuidl_t  
+tokid_t 
 _lexer::insert_token(
 	token &tok,
 	size_t position
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
-	if(position > _token.size()) {
+	if(position > _token_position.size()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
 			LEXER_EXCEPTION_INVALID_TOKEN_POSITION,
 			"pos. " << _position
 			);
 	}
-	_token.insert(std::pair<uuidl_t, token>(tok.get_id(), tok));
+	_store_token(tok);
 
 	if(position == _token.size()) {
 		_token_position.push_back(tok.get_id());
@@ -507,13 +849,12 @@ _lexer::insert_token(
 	return _token_position.at(position);
 }
 
-token &
+token_view 
 _lexer::move_next_token(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	token new_token;
-	size_t line, type;
 
 	if(!has_next_token()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
@@ -525,40 +866,19 @@ _lexer::move_next_token(void)
 
 	if(has_next_character()
 			&& _position == (_token_position.size() - 2)) {
-		line = get_character_row();
-		type = get_character_type();
-
-		switch(type) {
-			case CHARACTER_ALPHA:
-				_enumerate_alpha_token(new_token);
-				break;
-			case CHARACTER_DIGIT:
-				_enumerate_digit_token(new_token);
-				break;
-			case CHARACTER_SYMBOL:
-				_enumerate_symbol_token(new_token);
-				break;
-			default:
-				THROW_LEXER_EXCEPTION_WITH_MESSAGE(
-					LEXER_EXCEPTION_INVALID_TOKEN_TYPE,
-					"type. " << type
-					);
-		}
-		new_token.set_line(line);
-		new_token.set_origin(get_origin());
-		_token.insert(std::pair<uuidl_t, token>(new_token.get_id(), new_token));
-		_token_position.insert(_token_position.begin() + (++_position), new_token.get_id());
+		_enumerate_token(new_token);
+		_token_position.insert(_token_position.begin() + (++_position), _store_token(new_token, _origin));
 	} else if(_position < (_token_position.size() - 1)) {
 		++_position;
 	}
 	
-	return get_token();
+	return get_token_view();
 }
 
-token &
+token_view 
 _lexer::move_previous_token(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	if(!has_previous_token()) {
 		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
@@ -568,23 +888,61 @@ _lexer::move_previous_token(void)
 	}
 	--_position;
 
-	return get_token();
+	return get_token_view();
+}
+
+void 
+_lexer::replace_input(
+	size_t position,
+	size_t length,
+	const std::string &text
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	_token.pool_text();
+	lexer_base::replace_input(position, length, text);
+	_token.set_source(_input_data);
 }
 
 void 
 _lexer::reset(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	_position = 0;
 }
 
+void 
+_lexer::set_token_mode(
+	tokid_t id,
+	size_t mode
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	if(id >= _token.size()) {
+		THROW_LEXER_EXCEPTION_WITH_MESSAGE(
+			LEXER_EXCEPTION_TOKEN_NOT_FOUND,
+			"{" << id << "}"
+			);
+	}
+	_token.set_mode(id, mode);
+}
+
 size_t 
 _lexer::size(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
+
+	size_t result = _token_position.size() - 2;
+	std::vector<lexer_splice_t>::iterator splice_iter = _token_splice.begin();
 
-	return _token_position.size() - 2;
+	for(; splice_iter != _token_splice.end(); ++splice_iter) {
+		result += (splice_iter->end - splice_iter->begin);
+	}
+
+	return result;
 }
 
 std::string 
@@ -592,7 +950,7 @@ _lexer::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_lock);
 
 	std::stringstream ss;
 
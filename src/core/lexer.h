@@ -20,10 +20,32 @@
 #ifndef LEXER_H_
 #define LEXER_H_
 
+#include <exception>
 #include <vector>
 #include "lexer_base.h"
 #include "token.h"
-#include "uuid.h"
+#include "token_store.h"
+#include "token_view.h"
+
+typedef struct _lexer_boundary_t {
+	size_t line;
+	size_t position;
+} lexer_boundary_t, *lexer_boundary_ptr;
+
+typedef struct _lexer_chunk_t {
+	size_t begin;
+	size_t end;
+	size_t position;
+	bool complete;
+	std::exception_ptr error;
+	std::vector<token> result;
+} lexer_chunk_t, *lexer_chunk_ptr;
+
+typedef struct _lexer_splice_t {
+	tokid_t anchor;
+	tokid_t begin;
+	tokid_t end;
+} lexer_splice_t, *lexer_splice_ptr;
 
 typedef class _lexer :
 		public lexer_base{
@@ -53,28 +75,47 @@ typedef class _lexer :
 		 
 		std::vector<token> export_tokens(void);
 
-		uuidl_t get_begin_token_id(void);
+		tokid_t get_begin_token_id(void);
 
-		uuidl_t get_end_token_id(void);
+		tokid_t get_end_token_id(void);
 
-		token &get_token(void);
+		token get_token(void);
 
-		token &get_token(
-			uuidl_t id
+		token get_token(
+			tokid_t id
 			);
 
 		size_t get_token_position(void);
 
+		symid_t get_token_symbol(
+			tokid_t id
+			);
+
+		size_t get_token_type(
+			tokid_t id
+			);
+
+		token_view get_token_view(void);
+
+		token_view get_token_view(
+			tokid_t id
+			);
+
 		bool has_token(
-			uuidl_t id
+			tokid_t id
 			);
 
 		bool has_next_token(void);
 
 		bool has_previous_token(void);
 
-		void import_tokens(
-			std::vector<token> tokens
+		tokid_t import_tokens(
+			const std::vector<token> &tokens,
+			const std::string &origin
+			);
+
+		tokid_t import_tokens(
+			_lexer &other
 			);
 
 		virtual void initialize(
@@ -86,21 +127,38 @@ typedef class _lexer :
 			const _lexer &other
 			);
 
-		uuidl_t insert_token(
+		virtual void initialize(
+			const _lexer_base &other,
+			size_t begin,
+			size_t end
+			);
+
+		tokid_t insert_token(
 			token &tok
 			);
 
-		uuidl_t insert_token(
+		tokid_t insert_token(
 			token &tok,
 			size_t position
 			);
 
-		token &move_next_token(void);
+		token_view move_next_token(void);
+
+		token_view move_previous_token(void);
 
-		token &move_previous_token(void);
+		virtual void replace_input(
+			size_t position,
+			size_t length,
+			const std::string &text
+			);
 
 		virtual void reset(void);
 
+		void set_token_mode(
+			tokid_t id,
+			size_t mode
+			);
+
 		virtual size_t size(void);
 
 		virtual std::string to_string(
@@ -113,10 +171,16 @@ typedef class _lexer :
 			bool expect_eos = false
 			);
 
+		void _discover_parallel(void);
+
 		void _enumerate_alpha_token(
 			token &tok
 			);
 
+		void _enumerate_chunk(
+			lexer_chunk_t &chunk
+			);
+
 		void _enumerate_digit_token(
 			token &tok
 			);
@@ -125,17 +189,41 @@ typedef class _lexer :
 			token &tok
 			);
 
+		void _enumerate_token(
+			token &tok
+			);
+
+		std::vector<tokid_t> _export_index(void);
+
+		std::vector<tokid_t> _export_order(void);
+
 		void _skip_whitespace(void);
 
+		std::vector<lexer_boundary_t> _split_chunks(
+			size_t end,
+			size_t count
+			);
+
+		tokid_t _store_token(
+			token &tok
+			);
+
+		tokid_t _store_token(
+			token &tok,
+			const std::string &origin
+			);
+
 		size_t _position;
 
-		std::map<uuidl_t, token> _token;
+		token_store _token;
+
+		std::vector<tokid_t> _token_position;
 
-		std::vector<uuidl_t> _token_position;
+		std::vector<lexer_splice_t> _token_splice;
 
 	private:
 
-		std::recursive_mutex _lexer_lock;
+		object_lock_t _lexer_lock;
 
 } lexer, *lexer_ptr;
 
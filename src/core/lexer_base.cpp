@@ -17,11 +17,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fstream>
+#include <cstring>
 #include "lexer_base.h"
 #include "lexer_base_type.h"
 
-_lexer_base::_lexer_base(void)
+_lexer_base::_lexer_base(void) :
+	_input_begin(0),
+	_input_data(NULL),
+	_input_size(0)
 {
 	clear();
 }
@@ -29,14 +32,20 @@ _lexer_base::_lexer_base(void)
 _lexer_base::_lexer_base(
 	const std::string &input,
 	bool is_file
-	)
+	) :
+		_input_begin(0),
+		_input_data(NULL),
+		_input_size(0)
 {
 	initialize(input, is_file);
 }
 
 _lexer_base::_lexer_base(
 	const _lexer_base &other
-	)
+	) :
+		_input_begin(0),
+		_input_data(NULL),
+		_input_size(0)
 {
 	initialize(other);
 }
@@ -51,7 +60,7 @@ _lexer_base::operator=(
 	const _lexer_base &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	if(this != &other) {
 		initialize(other);
@@ -60,64 +69,184 @@ _lexer_base::operator=(
 	return *this;
 }
 
+void 
+_lexer_base::_advance_line(void)
+{
+	const char *newline;
+
+	if(_position < _line_begin) {
+		_line = _input->get_line(_position, _line_hint);
+		_set_line(_line, _input->get_line_position(_line));
+	}
+
+	while(_line_position < _position) {
+		newline = (const char *) memchr(_input_data + _line_position, CHARACTER_NEWLINE, 
+			_position - _line_position);
+
+		if(!newline) {
+			_line_position = _position;
+			break;
+		}
+		_line_position = (newline - _input_data) + 1;
+		_line_begin = _line_position;
+		++_line;
+	}
+}
+
 void 
 _lexer_base::_determine_character_type(void)
 {
-	char ch = get_character();
-	
-	if(IS_CHARACTER_ALPHA(ch)) {
-		_type = CHARACTER_ALPHA;
-	} else if(IS_CHARACTER_DIGIT(ch)) {
-		_type = CHARACTER_DIGIT;
-	} else if(IS_CHARACTER_WHITESPACE(ch)) {
-		_type = CHARACTER_WHITESPACE;
-	} else {
-		_type = CHARACTER_SYMBOL;
+	char ch = _position < _input_size ? _input_data[_position] : CHARACTER_END_STREAM;
+
+	_type = CHARACTER_CLASS_TYPE(CHARACTER_CLASS_OF(ch));
+}
+
+size_t 
+_lexer_base::_scan_character_class(
+	size_t position,
+	byte_t character_class
+	)
+{
+
+	while(position < _input_size
+			&& (CHARACTER_CLASS_OF(_input_data[position]) & character_class)) {
+		++position;
+	}
+
+	return position;
+}
+
+size_t 
+_lexer_base::_scan_line_end(
+	size_t position
+	)
+{
+#ifdef SIMD_SSE2
+	uint32_t mask;
+	__m128i block, end_stream = _mm_setzero_si128(),
+		newline = _mm_set1_epi8(CHARACTER_NEWLINE);
+
+	for(; (position + sizeof(__m128i)) <= _input_size; position += sizeof(__m128i)) {
+		block = _mm_loadu_si128((const __m128i *) (_input_data + position));
+		mask = (uint32_t) _mm_movemask_epi8(_mm_or_si128(
+			_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, end_stream)));
+
+		if(mask) {
+			return position + __trailing_zero_count(mask);
+		}
+	}
+#endif
+
+	while(position < _input_size
+			&& _input_data[position] != CHARACTER_NEWLINE
+			&& _input_data[position] != CHARACTER_END_STREAM) {
+		++position;
+	}
+
+	return position;
+}
+
+size_t 
+_lexer_base::_scan_whitespace(
+	size_t position
+	)
+{
+#ifdef SIMD_SSE2
+	uint32_t mask;
+	__m128i block, control, 
+		control_offset = _mm_set1_epi8((char) MAX_CONTROL_WHITESPACE_OFFSET),
+		space = _mm_set1_epi8(CHARACTER_SPACE),
+		tab = _mm_set1_epi8(CHARACTER_TAB);
+
+	for(; (position + sizeof(__m128i)) <= _input_size; position += sizeof(__m128i)) {
+		block = _mm_loadu_si128((const __m128i *) (_input_data + position));
+		control = _mm_sub_epi8(block, tab);
+		mask = (uint32_t) _mm_movemask_epi8(_mm_or_si128(
+			_mm_cmpeq_epi8(block, space), 
+			_mm_cmpeq_epi8(_mm_min_epu8(control, control_offset), control)));
+		mask = ~mask & 0xffff;
+
+		if(mask) {
+			return position + __trailing_zero_count(mask);
+		}
 	}
+#endif
+
+	return _scan_character_class(position, CHARACTER_CLASS_WHITESPACE);
+}
+
+void 
+_lexer_base::_set_line(
+	size_t line,
+	size_t line_begin
+	)
+{
+	_line = line;
+	_line_begin = line_begin;
+	_line_position = line_begin;
+}
+
+void 
+_lexer_base::_skip_characters(
+	size_t position
+	)
+{
+
+	if(position > _input_size) {
+		THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
+			LEXER_BASE_EXCEPTION_INVALID_CHARACTER_POSITION,
+			POSITION_STRING(position, get_character_row(), get_character_column())
+			);
+	}
+	_position = position;
+	_determine_character_type();
 }
 
 void 
 _lexer_base::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
-	_column = 0;
-	_column_length.clear();
-	_input.clear();
-	_input += CHARACTER_END_STREAM;
+	_input = std::shared_ptr<source>(new source);
+	_input_begin = 0;
+	_input_data = _input->get_data();
+	_input_size = _input->size();
+	_line_hint = 0;
 	_origin.clear();
 	_position = 0;
-	_row = 0;
+	_set_line(0, 0);
 	_determine_character_type();
 }
 
 char 
 _lexer_base::get_character(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
-	if(_position >= _input.size()) {
+	if(_position > _input_size) {
 		THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
 			LEXER_BASE_EXCEPTION_INVALID_CHARACTER_POSITION,
-			POSITION_STRING(_position, _row, _column)
+			POSITION_STRING(_position, get_character_row(), get_character_column())
 			);
 	}
 
-	return _input.at(_position);
+	return _position == _input_size ? CHARACTER_END_STREAM : _input_data[_position];
 }
 
 size_t 
 _lexer_base::get_character_column(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
+
+	_advance_line();
 
-	return _column;
+	return _position - _line_begin;
 }
 
 size_t 
 _lexer_base::get_character_position(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	return _position;
 }
@@ -125,15 +254,17 @@ _lexer_base::get_character_position(void)
 size_t 
 _lexer_base::get_character_row(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
-	return _row;
+	_advance_line();
+
+	return _line;
 }
 
 size_t 
 _lexer_base::get_character_type(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	return _type;
 }
@@ -141,7 +272,7 @@ _lexer_base::get_character_type(void)
 std::string 
 _lexer_base::get_origin(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	return _origin;
 }
@@ -149,7 +280,7 @@ _lexer_base::get_origin(void)
 std::string 
 _lexer_base::get_origin_path(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	std::string result;
 	size_t position = _origin.find_last_of(CHARACTER_DIRECTORY);
@@ -166,7 +297,7 @@ _lexer_base::get_origin_path(void)
 bool 
 _lexer_base::has_next_character(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	return get_character() != CHARACTER_END_STREAM;
 }
@@ -174,7 +305,7 @@ _lexer_base::has_next_character(void)
 bool 
 _lexer_base::has_previous_character(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	return _position > 0;
 }
@@ -185,29 +316,16 @@ _lexer_base::initialize(
 	bool is_file
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
-
-	std::stringstream ss;
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	clear();
+	_input = std::shared_ptr<source>(new source(input, is_file));
+	_input_data = _input->get_data();
+	_input_size = _input->size();
 
 	if(is_file) {
-		std::ifstream file(input.c_str(), std::ios::in);
-
-		if(!file) {
-			THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
-				LEXER_BASE_EXCEPTION_FILE_NOT_FOUND,
-				"\'" << input << "\'"
-				);
-		}
-		ss << file.rdbuf();
-		_input = ss.str();
 		_origin = input;
-		file.close();
-	} else {
-		_input = input;
 	}
-	_input += CHARACTER_END_STREAM;
 	_determine_character_type();
 }
 
@@ -216,43 +334,67 @@ _lexer_base::initialize(
 	const _lexer_base &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
-	_column = other._column;
-	_column_length = other._column_length;
 	_input = other._input;
+	_input_begin = other._input_begin;
+	_input_data = other._input_data;
+	_input_size = other._input_size;
+	_line = other._line;
+	_line_begin = other._line_begin;
+	_line_hint = other._line_hint;
+	_line_position = other._line_position;
 	_origin = other._origin;
 	_position = other._position;
-	_row = other._row;
 	_type = other._type;
 }
 
+void 
+_lexer_base::initialize(
+	const _lexer_base &other,
+	size_t begin,
+	size_t end
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
+
+	if(begin > end
+			|| end > other._input_size) {
+		THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
+			LEXER_BASE_EXCEPTION_INVALID_CHARACTER_POSITION,
+			"pos. " << begin << ", " << end
+			);
+	}
+	clear();
+	_input = other._input;
+	_input_begin = begin;
+	_input_data = other._input_data;
+	_input_size = end;
+	_origin = other._origin;
+	_position = begin;
+
+	if(begin >= other._line_begin
+			&& begin <= other._line_position) {
+		_line = other._line;
+		_line_begin = other._line_begin;
+		_line_position = begin;
+	} else {
+		_set_line(0, INVALID_POSITION);
+	}
+	_determine_character_type();
+}
+
 char 
 _lexer_base::move_next_character(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
-
-	char ch;
-	std::map<size_t, size_t>::iterator column_length_iter;
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	if(!has_next_character()) {
 		THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
 			LEXER_BASE_EXCEPTION_NO_NEXT_CHARACTER,
-			POSITION_STRING(_position, _row, _column)
+			POSITION_STRING(_position, get_character_row(), get_character_column())
 			);
 	}
-	ch = get_character();
-
-	if(ch == CHARACTER_NEWLINE) {
-		column_length_iter = _column_length.find(_row);
-
-		if(column_length_iter == _column_length.end()) {
-			_column_length.insert(std::pair<size_t, size_t>(_row++, _column));
-		}
-		_column = 0;
-	} else {
-		++_column;
-	}
 	++_position;
 	_determine_character_type();
 
@@ -262,55 +404,68 @@ _lexer_base::move_next_character(void)
 char 
 _lexer_base::move_previous_character(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
-
-	char ch;
-	std::map<size_t, size_t>::iterator column_length_iter;
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	if(!has_previous_character()) {
 		THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
 			LEXER_BASE_EXCEPTION_NO_PREVIOUS_CHARACTER,
-			POSITION_STRING(_position, _row, _column)
+			POSITION_STRING(_position, get_character_row(), get_character_column())
 			);
 	}
 	--_position;
-	ch = get_character();
+	_determine_character_type();
 
-	if(ch == CHARACTER_NEWLINE) {
-		column_length_iter = _column_length.find(--_row);
+	return get_character();
+}
 
-		if(column_length_iter == _column_length.end()) {
-			THROW_LEXER_BASE_EXCEPTION_WITH_MESSAGE(
-				LEXER_BASE_EXCEPTION_INVALID_COLUMN_LENGTH,
-				"row. " << _row
-				);
-		}
-		_column = column_length_iter->second;
-	} else {
-		--_column;
+void 
+_lexer_base::replace_input(
+	size_t position,
+	size_t length,
+	const std::string &text
+	)
+{
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
+
+	if(_input.use_count() > 1) {
+		_input = std::shared_ptr<source>(new source(*_input));
 	}
-	_determine_character_type();
+	_input->replace(position, length, text);
+	_input_data = _input->get_data();
+	_input_size = _input->size();
 
-	return get_character();
+	if(position < _line_position) {
+		_set_line(0, INVALID_POSITION);
+	}
+
+	if(_position >= (position + length)) {
+		_position = (_position + text.size()) - length;
+	} else if(_position > position) {
+		_position = position;
+	}
+	_determine_character_type();
 }
 
 void 
 _lexer_base::reset(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
-	_column = 0;
-	_position = 0;
-	_row = 0;
+	_line_hint = 0;
+	_position = _input_begin;
+
+	if(!_input_begin) {
+		_set_line(0, 0);
+	}
 	_determine_character_type();
 }
 
 size_t 
 _lexer_base::size(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 	
-	return _input.size() - 1;
+	return _input_size;
 }
 
 std::string 
@@ -318,7 +473,7 @@ _lexer_base::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _lexer_base_lock);
+	LOCK_OBJECT(object_lock_t, _lexer_base_lock);
 
 	std::stringstream ss;
 	char ch = get_character();
@@ -331,7 +486,7 @@ _lexer_base::to_string(
 			&& ch != CHARACTER_END_STREAM) {
 		ss << "\'" << ch << "\' (" << VALUE_AS_HEX(byte_t, ch) << ") ";
 	}
-	ss << POSITION_STRING(_position, _row, _column);
+	ss << POSITION_STRING(_position, get_character_row(), get_character_column());
 
 
 	return ss.str();
@@ -20,7 +20,8 @@
 #ifndef LEXER_BASE_H_
 #define LEXER_BASE_H_
 
-#include <map>
+#include <memory>
+#include "source.h"
 #include "type.h"
 
 typedef class _lexer_base {
@@ -73,10 +74,22 @@ typedef class _lexer_base {
 			const _lexer_base &other
 			);
 
+		virtual void initialize(
+			const _lexer_base &other,
+			size_t begin,
+			size_t end
+			);
+
 		char move_next_character(void);
 
 		char move_previous_character(void);
 
+		virtual void replace_input(
+			size_t position,
+			size_t length,
+			const std::string &text
+			);
+
 		virtual void reset(void);
 
 		virtual size_t size(void);
@@ -87,25 +100,57 @@ typedef class _lexer_base {
 
 	protected:
 
+		void _advance_line(void);
+
 		void _determine_character_type(void);
 
-		size_t _column;
+		size_t _scan_character_class(
+			size_t position,
+			byte_t character_class
+			);
+
+		size_t _scan_line_end(
+			size_t position
+			);
+
+		size_t _scan_whitespace(
+			size_t position
+			);
+
+		void _set_line(
+			size_t line,
+			size_t line_begin
+			);
+
+		void _skip_characters(
+			size_t position
+			);
+
+		std::shared_ptr<source> _input;
+
+		size_t _input_begin;
 
-		std::map<size_t, size_t> _column_length;
+		const char *_input_data;
 
-		std::string _input;
+		size_t _input_size;
 
 		std::string _origin;
 
-		size_t _position;
+		size_t _line;
+
+		size_t _line_begin;
+
+		size_t _line_hint;
 
-		size_t _row;
+		size_t _line_position;
+
+		size_t _position;
 
 		size_t _type;
 
 	private:
 
-		std::recursive_mutex _lexer_base_lock;
+		object_lock_t _lexer_base_lock;
 
 } lexer_base, *lexer_base_ptr;
 
@@ -29,6 +29,17 @@ enum {
 	CHARACTER_WHITESPACE,
 };
 
+enum {
+	CHARACTER_CLASS_ALPHA = 0x1,
+	CHARACTER_CLASS_DIGIT = 0x2,
+	CHARACTER_CLASS_WHITESPACE = 0x4,
+	CHARACTER_CLASS_SYMBOL = 0x8,
+	CHARACTER_CLASS_HEXIDECIMAL = 0x10,
+	CHARACTER_CLASS_UNDERSCORE = 0x20,
+	CHARACTER_CLASS_COMMENT = 0x40,
+	CHARACTER_CLASS_LOWERCASE = 0x80,
+};
+
 enum {
 	LEXER_BASE_EXCEPTION_FILE_NOT_FOUND = 0,
 	LEXER_BASE_EXCEPTION_INVALID_CHARACTER_POSITION,
@@ -37,6 +48,25 @@ enum {
 	LEXER_BASE_EXCEPTION_NO_PREVIOUS_CHARACTER,
 };
 
+static const byte_t CHARACTER_CLASS[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x00, 0x08, 0x00, 0x20,
+	0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const std::string CHARACTER_TYPE_STR[] = {
 	"ALPHA", "DIGIT", "SYMBOL", "WHITESPACE",
 };
@@ -49,20 +79,30 @@ static const std::string LEXER_BASE_EXCEPTION_STR[] = {
 	"No previous character",
 };
 
+#define CHARACTER_CARRIAGE_RETURN '\r'
 #define CHARACTER_DIRECTORY '\\'
 #define CHARACTER_END_STREAM '\0'
 #define CHARACTER_NEWLINE '\n'
+#define CHARACTER_SPACE ' '
+#define CHARACTER_TAB '\t'
 #define DEFAULT_ORIGIN ".\\"
 #define LEXER_BASE_EXCEPTION_HEADER "LEXER BASE"
 #define MAX_CHARACTER_TYPE CHARACTER_WHITESPACE
+#define MAX_CONTROL_WHITESPACE_OFFSET ('\r' - CHARACTER_TAB)
 #define MAX_LEXER_BASE_EXCEPTION LEXER_BASE_EXCEPTION_NO_PREVIOUS_CHARACTER
 #define SHOW_LEXER_BASE_EXCEPTION_HEADER true
 
+#define CHARACTER_CLASS_OF(_C_) CHARACTER_CLASS[(byte_t) (_C_)]
+#define CHARACTER_CLASS_TYPE(_CL_)\
+	((_CL_) & CHARACTER_CLASS_ALPHA ? CHARACTER_ALPHA\
+	: ((_CL_) & CHARACTER_CLASS_DIGIT ? CHARACTER_DIGIT\
+	: ((_CL_) & CHARACTER_CLASS_WHITESPACE ? CHARACTER_WHITESPACE : CHARACTER_SYMBOL)))
 #define CHARACTER_TYPE_STRING(_T_)\
 	(_T_ > MAX_CHARACTER_TYPE ? UNKNOWN : CHARACTER_TYPE_STR[_T_])
-#define IS_CHARACTER_ALPHA(_C_) (isalpha(_C_) != 0)
-#define IS_CHARACTER_DIGIT(_C_) (isdigit(_C_) != 0)
-#define IS_CHARACTER_WHITESPACE(_C_) (isspace(_C_) != 0)
+#define IS_CHARACTER_ALPHA(_C_) ((CHARACTER_CLASS_OF(_C_) & CHARACTER_CLASS_ALPHA) != 0)
+#define IS_CHARACTER_CLASS(_C_, _CL_) ((CHARACTER_CLASS_OF(_C_) & (_CL_)) != 0)
+#define IS_CHARACTER_DIGIT(_C_) ((CHARACTER_CLASS_OF(_C_) & CHARACTER_CLASS_DIGIT) != 0)
+#define IS_CHARACTER_WHITESPACE(_C_) ((CHARACTER_CLASS_OF(_C_) & CHARACTER_CLASS_WHITESPACE) != 0)
 #define LEXER_BASE_EXCEPTION_STRING(_T_)\
 	(_T_ > MAX_LEXER_BASE_EXCEPTION ? UNKNOWN : LEXER_BASE_EXCEPTION_STR[_T_])
 #define POSITION_STRING(_P_, _R_, _C_) "pos. " << _P_ << " {" << _R_ << ", " << _C_ << "}"
@@ -62,14 +62,22 @@ static const std::string LEXER_EXCEPTION_STR[] = {
 #define CHARACTER_STRING_DELIMITOR '\"'
 #define CHARACTER_UNDERSCORE '_'
 #define CHARACTER_ZERO '0'
+#define HEXIDECIMAL_OFFSET (10)
+#define HEXIDECIMAL_RADIX (16)
+#define INTEGER_RADIX (10)
+#define LEXER_CHUNK_LENGTH_MIN 0x100000
 #define LEXER_EXCEPTION_HEADER "LEXER"
 #define MAX_LEXER_EXCEPTION LEXER_EXCEPTION_UNTERMINATED_STRING_LITERAL
 #define SHOW_LEXER_EXCEPTION_HEADER true
 
+#define HEXIDECIMAL_CHARACTER_VALUE(_C_)\
+	(IS_CHARACTER_DIGIT(_C_) ? ((_C_) - CHARACTER_ZERO)\
+	: (IS_CHARACTER_CLASS(_C_, CHARACTER_CLASS_LOWERCASE) ? (((_C_) - CHARACTER_HEXIDECIMAL_LOWER_0) + HEXIDECIMAL_OFFSET)\
+	: (((_C_) - CHARACTER_HEXIDECIMAL_UPPER_0) + HEXIDECIMAL_OFFSET)))
 #define IS_HEXIDECIMAL_CHARACTER(_C_)\
 	((_C_ >= CHARACTER_HEXIDECIMAL_LOWER_0 && _C_ <= CHARACTER_HEXIDECIMAL_LOWER_1)\
 	|| (_C_ >= CHARACTER_HEXIDECIMAL_UPPER_0 && _C_ <= CHARACTER_HEXIDECIMAL_UPPER_1))
-#define IS_VALUE_TYPE(_C_) (isxdigit(_C_) != 0)
+#define IS_VALUE_TYPE(_C_) IS_CHARACTER_CLASS(_C_, CHARACTER_CLASS_HEXIDECIMAL)
 #define LEXER_EXCEPTION_STRING(_T_)\
 	(_T_ > MAX_LEXER_EXCEPTION ? UNKNOWN_EXCEPTION : LEXER_EXCEPTION_STR[_T_])
 #define THROW_LEXER_EXCEPTION(_T_)\
@@ -26,20 +26,15 @@ _node::_node(void)
 }
 
 _node::_node(
-	const uuidl_t &id
+	tokid_t id,
+	nodeid_t parent
 	) :
+		_child_count(0),
+		_first_child(INVALID_NODE_ID),
 		_id(id),
-		_parent_position(INVALID_TYPE)
-{
-	return;
-}
-
-_node::_node(
-	const uuidl_t &id,
-	size_t parent
-	) :
-		_id(id),
-		_parent_position(parent)
+		_last_child(INVALID_NODE_ID),
+		_next_sibling(INVALID_NODE_ID),
+		_parent(parent)
 {
 	return;
 }
@@ -47,9 +42,12 @@ _node::_node(
 _node::_node(
 	const _node &other
 	) :
-		_child_position(other._child_position),
+		_child_count(other._child_count),
+		_first_child(other._first_child),
 		_id(other._id),
-		_parent_position(other._parent_position)
+		_last_child(other._last_child),
+		_next_sibling(other._next_sibling),
+		_parent(other._parent)
 {
 	return;
 }
@@ -64,167 +62,132 @@ _node::operator=(
 	const _node &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
 
 	if(this != &other) {
-		_child_position = other._child_position;
+		_child_count = other._child_count;
+		_first_child = other._first_child;
 		_id = other._id;
-		_parent_position = other._parent_position;
+		_last_child = other._last_child;
+		_next_sibling = other._next_sibling;
+		_parent = other._parent;
 	}
 
 	return *this;
 }
 
 void 
-	_node::add_child_position(
-	size_t child_position
+_node::add_child(
+	nodeid_t child
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
 
-	_child_position.push_back(child_position);
+	if(_first_child == INVALID_NODE_ID) {
+		_first_child = child;
+	}
+	_last_child = child;
+	++_child_count;
 }
 
 void 
 _node::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	_child_position.clear();
-	_id = uuid::NULL_LONG_ID;
-	_parent_position = INVALID_TYPE;
+	_child_count = 0;
+	_first_child = INVALID_NODE_ID;
+	_id = INVALID_TOKEN_ID;
+	_last_child = INVALID_NODE_ID;
+	_next_sibling = INVALID_NODE_ID;
+	_parent = INVALID_NODE_ID;
 }
 
-size_t 
-_node::get_child_position(
-	size_t position
-	)
+nodeid_t 
+_node::get_first_child(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	if(position >= _child_position.size()) {
-		THROW_NODE_EXCEPTION_WITH_MESSAGE(
-			NODE_EXCEPTION_INVALID_CHILD_POSITION,
-			"pos. " << position
-			);
-	}
-
-	return _child_position.at(position);
+	return _first_child;
 }
 
-uuidl_t 
-_node::get_id(void)
+tokid_t 
+_node::get_id(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
 	return _id;
 }
 
-size_t 
-_node::get_parent_position(void)
+nodeid_t 
+_node::get_last_child(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	return _parent_position;
+	return _last_child;
 }
 
-bool 
-_node::has_children(void)
+nodeid_t 
+_node::get_next_sibling(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
+	return _next_sibling;
+}
 
-	return !_child_position.empty();
+nodeid_t 
+_node::get_parent(void) const
+{
+	return _parent;
 }
 
 bool 
-_node::has_parent(void)
+_node::has_children(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	return _parent_position != INVALID_TYPE; 
+	return _first_child != INVALID_NODE_ID;
 }
 
-void 
-_node::insert_child_position(
-	size_t child_position,
-	size_t position
-	)
+bool 
+_node::has_next_sibling(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	if(position > _child_position.size()) {
-		THROW_NODE_EXCEPTION_WITH_MESSAGE(
-			NODE_EXCEPTION_INVALID_CHILD_POSITION,
-			"pos. " << position
-			);
-	}
+	return _next_sibling != INVALID_NODE_ID;
+}
 
-	if(position == _child_position.size()) {
-		_child_position.push_back(child_position);
-	} else {
-		_child_position.insert(_child_position.begin() + position, child_position);
-	}
+bool 
+_node::has_parent(void) const
+{
+	return _parent != INVALID_NODE_ID; 
 }
 
 void 
-_node::remove_child_position(
-	size_t position
+_node::rebase(
+	nodeid_t base,
+	nodeid_t new_base
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
 
-	if(position >= _child_position.size()) {
-		THROW_NODE_EXCEPTION_WITH_MESSAGE(
-			NODE_EXCEPTION_INVALID_CHILD_POSITION,
-			"pos. " << position
-			);
+	if(_first_child != INVALID_NODE_ID) {
+		_first_child = (_first_child - base) + new_base;
+		_last_child = (_last_child - base) + new_base;
 	}
-	_child_position.erase(_child_position.begin() + position);
-}
 
-void 
-_node::set_child_position(
-	size_t child_position,
-	size_t position
-	)
-{
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
+	if(_next_sibling != INVALID_NODE_ID) {
+		_next_sibling = (_next_sibling - base) + new_base;
+	}
 
-	if(position >= _child_position.size()) {
-		THROW_NODE_EXCEPTION_WITH_MESSAGE(
-			NODE_EXCEPTION_INVALID_CHILD_POSITION,
-			"pos. " << position
-			);
+	if(_parent != INVALID_NODE_ID) {
+		_parent = (_parent - base) + new_base;
 	}
-	_child_position.at(position) = child_position;
 }
 
 void 
 _node::set_id(
-	const uuidl_t &id
+	tokid_t id
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
 	_id = id;
 }
 
 void 
-_node::set_parent_position(
-	size_t position
+_node::set_next_sibling(
+	nodeid_t sibling
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-	
-	_parent_position = position;
+	_next_sibling = sibling;
 }
 
 size_t 
-_node::size(void)
+_node::size(void) const
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
-	return _child_position.size();
+	return _child_count;
 }
 
 std::string 
@@ -232,14 +195,12 @@ _node::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _node_lock);
-
 	std::stringstream ss;
 
 	if(verbose) {
-		ss << "{" << LONG_ID_AS_STRING(_id) << "} ";
+		ss << "{" << _id << "} ";
 	}
-	ss << " (" << _child_position.size() << ")";
+	ss << " (" << _child_count << ")";
 
 	if(!has_parent()) {
 		ss << " [ROOT]";
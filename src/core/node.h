@@ -20,9 +20,7 @@
 #ifndef NODE_H_
 #define NODE_H_
 
-#include <vector>
 #include "type.h"
-#include "uuid.h"
 
 typedef class _node {
 
@@ -31,81 +29,74 @@ typedef class _node {
 		_node(void);
 
 		_node(
-			const uuidl_t &id
-			);
-
-		_node(
-			const uuidl_t &id,
-			size_t parent
+			tokid_t id,
+			nodeid_t parent = INVALID_NODE_ID
 			);
 
 		_node(
 			const _node &other
 			);
 
-		virtual ~_node(void);
+		~_node(void);
 
 		_node &operator=(
 			const _node &other
 			);
 
-		void add_child_position(
-			size_t child_position
+		void add_child(
+			nodeid_t child
 			);
 
-		virtual void clear(void);
+		void clear(void);
 
-		size_t get_child_position(
-			size_t position
-			);
+		nodeid_t get_first_child(void) const;
 
-		uuidl_t get_id(void);
+		tokid_t get_id(void) const;
 
-		size_t get_parent_position(void);
+		nodeid_t get_last_child(void) const;
 
-		bool has_children(void);
+		nodeid_t get_next_sibling(void) const;
 
-		bool has_parent(void);
+		nodeid_t get_parent(void) const;
 
-		void insert_child_position(
-			size_t child_position,
-			size_t position
-			);
+		bool has_children(void) const;
 
-		void remove_child_position(
-			size_t position
-			);
+		bool has_next_sibling(void) const;
 
-		void set_child_position(
-			size_t child_position,
-			size_t position
+		bool has_parent(void) const;
+
+		void rebase(
+			nodeid_t base,
+			nodeid_t new_base
 			);
 
 		void set_id(
-			const uuidl_t &id
+			tokid_t id
 			);
 
-		void set_parent_position(
-			size_t position
+		void set_next_sibling(
+			nodeid_t sibling
 			);
 
-		virtual size_t size(void);
+		size_t size(void) const;
 
-		virtual std::string to_string(
+		std::string to_string(
 			bool verbose
 			);
 
 	protected:
 
-		uuidl_t _id;
+		uint32_t _child_count;
+
+		nodeid_t _first_child;
 
-		size_t _parent_position;
+		tokid_t _id;
 
-		std::vector<size_t> _child_position;
+		nodeid_t _last_child;
 
-	private:
+		nodeid_t _next_sibling;
 
-		std::recursive_mutex _node_lock;
+		nodeid_t _parent;
 
 } node, *node_ptr;
 
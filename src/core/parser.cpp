@@ -52,7 +52,7 @@ _parser::operator=(
 	const _parser &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	if(this != &other) {
 		initialize(other);
@@ -82,46 +82,82 @@ _parser::_advance_token(
 	move_next_token();
 }
 
-size_t 
+stmtid_t 
+_parser::_append_statement(
+	nodeid_t begin
+	)
+{
+	statement_t statement = { begin, begin, INVALID_STATEMENT_ID, INVALID_STATEMENT_ID };
+
+	_statement.push_back(statement);
+
+	return (stmtid_t) (_statement.size() - 1);
+}
+
+nodeid_t 
 _parser::_append_token(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	return _append_token(get_token().get_id(), statement, parent_position);
+	return _append_token(get_token_view().get_id(), parent);
 }
 
-size_t 
+nodeid_t 
 _parser::_append_token(
-	const uuidl_t &id,
-	std::vector<node> &statement,
-	size_t parent_position
+	tokid_t id,
+	nodeid_t parent
 	)
 {
-	statement.push_back(id);
+	nodeid_t result = (nodeid_t) _node_pool.size();
 
-	if(parent_position != INVALID_TYPE) {
+	if(parent != INVALID_NODE_ID) {
 
-		if(parent_position >= statement.size()) {
+		if(parent >= _node_pool.size()) {
 			THROW_PARSER_EXCEPTION_WITH_MESSAGE(
 				PARSER_EXCEPTION_INVALID_PARENT_POSITION,
-				"pos. " << parent_position
+				"pos. " << parent
 				);
 		}
-		statement.at(parent_position).add_child_position(statement.size() - 1);
-		statement.back().set_parent_position(parent_position);
+
+		if(_node_pool[parent].has_children()) {
+			_node_pool[_node_pool[parent].get_last_child()].set_next_sibling(result);
+		}
+		_node_pool[parent].add_child(result);
 	}
+	_node_pool.push_back(node(id, parent));
 
-	return statement.size() - 1;
+	return result;
 }
 
 void 
-_parser::_enumerate_command(
-	std::vector<node> &statement
+_parser::_discover_chunk(
+	_parser &worker,
+	parser_chunk_t &chunk
 	)
 {
-	token tok = get_token();
-	size_t parent_position = INVALID_TYPE;
+
+	try {
+		worker.clear();
+
+		while(worker.has_next_statement()) {
+			worker.move_next_statement();
+		}
+		worker.reset();
+		chunk.statements = worker.export_statements();
+		chunk.complete = true;
+	} catch(std::runtime_error &) {
+		chunk.complete = false;
+	} catch(...) {
+		chunk.complete = false;
+		chunk.error = std::current_exception();
+	}
+}
+
+void 
+_parser::_enumerate_command(void)
+{
+	token_view tok = get_token_view();
+	nodeid_t parent = INVALID_NODE_ID;
 
 	if(tok.get_type() != TOKEN_BASIC_OPCODE
 			&& tok.get_type() != TOKEN_SPECIAL_OPCODE) {
@@ -130,12 +166,12 @@ _parser::_enumerate_command(
 			lexer::to_string(false)
 			);
 	}
-	parent_position = _append_token(statement);
+	parent = _append_token();
 	_advance_token();
 
 	if(tok.get_type() == TOKEN_BASIC_OPCODE) {
-		_enumerate_operand_b(statement, parent_position);
-		tok = get_token();
+		_enumerate_operand_b(parent);
+		tok = get_token_view();
 
 		if(tok.get_type() != TOKEN_SYMBOL
 				|| (tok.get_type() == TOKEN_SYMBOL
@@ -147,16 +183,14 @@ _parser::_enumerate_command(
 		}
 		_advance_token();
 	}
-	_enumerate_operand_a(statement, parent_position);
+	_enumerate_operand_a(parent);
 }
 
 void 
-_parser::_enumerate_directive(
-	std::vector<node> &statement
-	)
+_parser::_enumerate_directive(void)
 {
-	token tok = get_token();
-	size_t parent_position = INVALID_TYPE;
+	token_view tok = get_token_view();
+	nodeid_t parent = INVALID_NODE_ID;
 
 	if(tok.get_type() != TOKEN_DIRECTIVE) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -164,16 +198,16 @@ _parser::_enumerate_directive(
 			lexer::to_string(false)
 			);
 	}
-	parent_position = _append_token(statement);
+	parent = _append_token();
 	_advance_token();
 
 	switch(tok.get_subtype()) {
 		case DIRECTIVE_DATA:
-			_enumerate_value_list(statement, parent_position);
+			_enumerate_value_list(parent);
 			break;
 		case DIRECTIVE_INCBIN:
 		case DIRECTIVE_INCLUDE:
-			tok = get_token();
+			tok = get_token_view();
 
 			if(tok.get_type() != TOKEN_VALUE
 					|| tok.get_subtype() != VALUE_STRING_VAR) {
@@ -182,11 +216,11 @@ _parser::_enumerate_directive(
 					lexer::to_string(true)
 					);
 			}
-			_append_token(statement, parent_position);
+			_append_token(parent);
 			_advance_token();
 			break;
 		case DIRECTIVE_RESERVE:
-			tok = get_token();
+			tok = get_token_view();
 
 			if(tok.get_type() != TOKEN_VALUE
 					|| tok.get_subtype() != VALUE_INTEGER) {
@@ -195,7 +229,7 @@ _parser::_enumerate_directive(
 					lexer::to_string(true)
 					);
 			}
-			_append_token(statement, parent_position);
+			_append_token(parent);
 			_advance_token();
 			break;
 		default:
@@ -204,11 +238,9 @@ _parser::_enumerate_directive(
 }
 
 void 
-_parser::_enumerate_label(
-	std::vector<node> &statement
-	)
+_parser::_enumerate_label(void)
 {
-	token tok = get_token();
+	token_view tok = get_token_view();
 
 	if(tok.get_type() != TOKEN_SYMBOL
 			|| (tok.get_type() == TOKEN_SYMBOL
@@ -219,7 +251,7 @@ _parser::_enumerate_label(
 			);
 	}
 	_advance_token();
-	tok = get_token();
+	tok = get_token_view();
 
 	if(tok.get_type() != TOKEN_LABEL) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -227,17 +259,16 @@ _parser::_enumerate_label(
 			lexer::to_string(false)
 			);
 	}
-	_append_token(statement);
+	_append_token();
 	_advance_token();
 }
 
 void 
 _parser::_enumerate_operand(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok = get_token();
+	token_view tok = get_token_view();
 	bool found_parenthesis = false;
 
 	switch(tok.get_type()) {
@@ -245,23 +276,23 @@ _parser::_enumerate_operand(
 
 			switch(tok.get_subtype()) {
 				case OPERATOR_PEEK:
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_PEEK);
+					_set_operand_mode(parent, ADDRESSING_MODE_PEEK);
 					_advance_token();
 					break;
 				case OPERATOR_PICK:
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_PICK);
+					_set_operand_mode(parent, ADDRESSING_MODE_PICK);
 					_advance_token();
-					tok = get_token();
+					tok = get_token_view();
 
 					if(tok.get_type() == TOKEN_SYMBOL 
 							&& tok.get_subtype() == SYMBOL_OPEN_PARENTHESIS) {
 						found_parenthesis = true;
 						_advance_token();
 					}
-					_enumerate_static_value(statement, parent_position);
+					_enumerate_static_value(parent);
 					
 					if(found_parenthesis) {
-						tok = get_token();
+						tok = get_token_view();
 						
 						if(tok.get_type() != TOKEN_SYMBOL
 								|| (tok.get_type() == TOKEN_SYMBOL
@@ -282,8 +313,8 @@ _parser::_enumerate_operand(
 			}
 			break;
 		case TOKEN_REGISTER:
-			_set_operand_mode(statement, parent_position, ADDRESSING_MODE_REGISTER);
-			_append_token(statement, parent_position);
+			_set_operand_mode(parent, ADDRESSING_MODE_REGISTER);
+			_append_token(parent);
 			_advance_token();
 			break;
 		case TOKEN_SYMBOL:
@@ -295,30 +326,30 @@ _parser::_enumerate_operand(
 					);
 			}
 			_advance_token();
-			tok = get_token();
+			tok = get_token_view();
 
 			if(tok.get_type() == TOKEN_REGISTER) {
-				_set_operand_mode(statement, parent_position, ADDRESSING_MODE_INDIRECT_REGISTER);
-				_append_token(statement, parent_position);
+				_set_operand_mode(parent, ADDRESSING_MODE_INDIRECT_REGISTER);
+				_append_token(parent);
 				_advance_token();
-				tok = get_token();
+				tok = get_token_view();
 
 				if(tok.get_type() == TOKEN_SYMBOL
 						&& tok.get_subtype() == SYMBOL_ADD_NEXT) {
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD);
+					_set_operand_mode(parent, ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD);
 					_advance_token();
-					_enumerate_static_value(statement, parent_position);
+					_enumerate_static_value(parent);
 				}
 			} else {
-				_set_operand_mode(statement, parent_position, ADDRESSING_MODE_INDIRECT_NEXT_WORD);
-				_enumerate_static_value(statement, parent_position);
-				tok = get_token();
+				_set_operand_mode(parent, ADDRESSING_MODE_INDIRECT_NEXT_WORD);
+				_enumerate_static_value(parent);
+				tok = get_token_view();
 
 				if(tok.get_type() == TOKEN_SYMBOL
 						&& tok.get_subtype() == SYMBOL_ADD_NEXT) {
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD);
+					_set_operand_mode(parent, ADDRESSING_MODE_INDIRECT_REGISTER_NEXT_WORD);
 					_advance_token();
-					tok = get_token();
+					tok = get_token_view();
 					
 					if(tok.get_type() != TOKEN_REGISTER) {
 						THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -326,11 +357,11 @@ _parser::_enumerate_operand(
 							lexer::to_string(false)
 							);
 					}
-					_append_token(statement, parent_position);
+					_append_token(parent);
 					_advance_token();
 				}
 			}
-			tok = get_token();
+			tok = get_token_view();
 
 			if(tok.get_type() != TOKEN_SYMBOL
 					|| (tok.get_type() == TOKEN_SYMBOL
@@ -346,13 +377,13 @@ _parser::_enumerate_operand(
 
 			switch(tok.get_subtype()) {
 				case SYSTEM_REGISTER_EX:
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_EX_LITERAL);
+					_set_operand_mode(parent, ADDRESSING_MODE_EX_LITERAL);
 					break;
 				case SYSTEM_REGISTER_PC:
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_PC_LITERAL);
+					_set_operand_mode(parent, ADDRESSING_MODE_PC_LITERAL);
 					break;
 				case SYSTEM_REGISTER_SP:
-					_set_operand_mode(statement, parent_position, ADDRESSING_MODE_SP_LITERAL);
+					_set_operand_mode(parent, ADDRESSING_MODE_SP_LITERAL);
 					break;
 				default:
 					THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -363,83 +394,79 @@ _parser::_enumerate_operand(
 			_advance_token();
 			break;
 		default:
-			_set_operand_mode(statement, parent_position, ADDRESSING_MODE_NEXT_WORD_LITERAL);
-			_enumerate_static_value(statement, parent_position);
+			_set_operand_mode(parent, ADDRESSING_MODE_NEXT_WORD_LITERAL);
+			_enumerate_static_value(parent);
 			break;
 	}
 }
 
 void 
 _parser::_enumerate_operand_a(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok, oper_tok(TOKEN_OPERAND);
+	token_view tok;
+	token oper_tok(TOKEN_OPERAND);
 
-	parent_position = _append_token(insert_token(oper_tok), statement, parent_position);
+	parent = _append_token(insert_token(oper_tok), parent);
 	_advance_token();
-	tok = get_token();
+	tok = get_token_view();
 
 	if(tok.get_type() == TOKEN_SYMBOL
 			&& tok.get_subtype() == SYMBOL_LITERAL_VALUE_DELIMITOR) {
-		_set_operand_mode(statement, parent_position, ADDRESSING_MODE_LITERAL);
+		_set_operand_mode(parent, ADDRESSING_MODE_LITERAL);
 		_advance_token();
-		_enumerate_static_value(statement, parent_position);
+		_enumerate_static_value(parent);
 	} else if(tok.get_type() == TOKEN_OPERATOR
 			&& tok.get_subtype() == OPERATOR_POP) {
-		_set_operand_mode(statement, parent_position, ADDRESSING_MODE_PUSH_POP);
-		_append_token(statement, parent_position);
+		_set_operand_mode(parent, ADDRESSING_MODE_PUSH_POP);
+		_append_token(parent);
 		_advance_token();
 	} else {
-		_enumerate_operand(statement, parent_position);
+		_enumerate_operand(parent);
 	}
 }
 
 void 
 _parser::_enumerate_operand_b(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok, oper_tok(TOKEN_OPERAND);
+	token_view tok;
+	token oper_tok(TOKEN_OPERAND);
 
-	parent_position = _append_token(insert_token(oper_tok), statement, parent_position);
+	parent = _append_token(insert_token(oper_tok), parent);
 	_advance_token();
-	tok = get_token();
+	tok = get_token_view();
 
 	if(tok.get_type() == TOKEN_OPERATOR
 			&& tok.get_subtype() == OPERATOR_PUSH) {
-		_set_operand_mode(statement, parent_position, ADDRESSING_MODE_PUSH_POP);
-		_append_token(statement, parent_position);
+		_set_operand_mode(parent, ADDRESSING_MODE_PUSH_POP);
+		_append_token(parent);
 		_advance_token();
 	} else {
-		_enumerate_operand(statement, parent_position);
+		_enumerate_operand(parent);
 	}
 }
 
 void 
-_parser::_enumerate_statement(
-	std::vector<node> &statement
-	)
+_parser::_enumerate_statement(void)
 {
-	token tok = get_token();
-
-	statement.clear();
+	token_view tok = get_token_view();
 
 	switch(tok.get_type()) {
 		case TOKEN_BASIC_OPCODE:
 		case TOKEN_SPECIAL_OPCODE:
-			_enumerate_command(statement);
+			_enumerate_command();
 			break;
 		case TOKEN_DIRECTIVE:
-			_enumerate_directive(statement);
+			_enumerate_directive();
 			break;
 		case TOKEN_SYMBOL:
 
 			switch(tok.get_subtype()) {
 				case SYMBOL_LABEL_DELIMITOR:
-					_enumerate_label(statement);
+					_enumerate_label();
 					break;
 				default:
 					THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -458,11 +485,10 @@ _parser::_enumerate_statement(
 
 void 
 _parser::_enumerate_static_value(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok = get_token();
+	token_view tok = get_token_view();
 
 	switch(tok.get_type()) {
 		case TOKEN_LABEL:
@@ -474,7 +500,7 @@ _parser::_enumerate_static_value(
 					lexer::to_string(false)
 					);				
 			}
-			_append_token(statement, parent_position);
+			_append_token(parent);
 			_advance_token();
 			break;
 		default:
@@ -487,16 +513,15 @@ _parser::_enumerate_static_value(
 
 void 
 _parser::_enumerate_value(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok = get_token();
+	token_view tok = get_token_view();
 
 	switch(tok.get_type()) {
 		case TOKEN_LABEL:
 		case TOKEN_VALUE:
-			_append_token(statement, parent_position);
+			_append_token(parent);
 			_advance_token();
 			break;
 		default:
@@ -509,63 +534,163 @@ _parser::_enumerate_value(
 
 void 
 _parser::_enumerate_value_list(
-	std::vector<node> &statement,
-	size_t parent_position
+	nodeid_t parent
 	)
 {
-	token tok, list_tok(TOKEN_VALUE_LIST);
+	token_view tok;
+	token list_tok(TOKEN_VALUE_LIST);
 
-	parent_position = _append_token(insert_token(list_tok), statement, parent_position);
+	parent = _append_token(insert_token(list_tok), parent);
 	_advance_token();
-	_enumerate_value(statement, parent_position);
-	tok = get_token();
+	_enumerate_value(parent);
+	tok = get_token_view();
 
 	while(tok.get_type() == TOKEN_SYMBOL
 			&& tok.get_subtype() == SYMBOL_LIST_SEPERATOR) {
 		_advance_token();
-		_enumerate_value(statement, parent_position);
-		tok = get_token();
+		_enumerate_value(parent);
+		tok = get_token_view();
+	}
+}
+
+stmtid_t 
+_parser::_find_statement(
+	size_t position
+	)
+{
+	size_t count;
+	stmtid_t result = PARSER_BEGIN_STATEMENT;
+
+	if(position >= _statement_count) {
+		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
+			PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
+			"pos. " << position
+			);
 	}
+
+	if(position == _position) {
+		result = _current;
+	} else {
+
+		for(count = 0; count < position; ++count) {
+			result = _statement[result].next;
+		}
+	}
+
+	return result;
+}
+
+void 
+_parser::_link_statement(
+	stmtid_t id,
+	stmtid_t previous
+	)
+{
+	stmtid_t next = _statement[previous].next;
+
+	_statement[id].next = next;
+	_statement[id].previous = previous;
+	_statement[previous].next = id;
+
+	if(next != INVALID_STATEMENT_ID) {
+		_statement[next].previous = id;
+	}
+	++_statement_count;
 }
 
 void 
 _parser::_set_operand_mode(
-	std::vector<node> &statement,
-	size_t operand_position,
+	nodeid_t operand,
 	size_t mode
 	)
 {
-	if(operand_position >= statement.size()) {
+	if(operand >= _node_pool.size()) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
 			PARSER_EXCEPTION_INVALID_OPERAND_POSITION,
-			"pos. " << operand_position
+			"pos. " << operand
 			);
 	}
-	get_token(statement.at(operand_position).get_id()).set_mode(mode);
+	set_token_mode(_node_pool[operand].get_id(), mode);
+}
+
+std::vector<lexer_boundary_t> 
+_parser::_split_statements(
+	size_t end,
+	size_t count
+	)
+{
+	lexer probe;
+	token_view tok;
+	std::vector<lexer_boundary_t>::iterator boundary_iter;
+	std::vector<lexer_boundary_t> boundary = lexer::_split_chunks(end, count), result;
+
+	result.push_back(boundary.front());
+
+	for(boundary_iter = boundary.begin() + 1; boundary_iter < boundary.end() - 1; ++boundary_iter) {
+
+		try {
+			probe.initialize(*this, boundary_iter->position, end);
+			tok = probe.move_next_token();
+		} catch(std::runtime_error &) {
+			continue;
+		}
+
+		if(tok.get_type() == TOKEN_BASIC_OPCODE
+				|| tok.get_type() == TOKEN_SPECIAL_OPCODE
+				|| tok.get_type() == TOKEN_DIRECTIVE
+				|| (tok.get_type() == TOKEN_SYMBOL
+						&& tok.get_subtype() == SYMBOL_LABEL_DELIMITOR)) {
+			result.push_back(*boundary_iter);
+		}
+	}
+	result.push_back(boundary.back());
+
+	return result;
+}
+
+void 
+_parser::_unlink_statement(
+	stmtid_t id
+	)
+{
+	stmtid_t next = _statement[id].next, previous = _statement[id].previous;
+
+	if(previous != INVALID_STATEMENT_ID) {
+		_statement[previous].next = next;
+	}
+
+	if(next != INVALID_STATEMENT_ID) {
+		_statement[next].previous = previous;
+	}
+	_statement[id].next = INVALID_STATEMENT_ID;
+	_statement[id].previous = INVALID_STATEMENT_ID;
+	--_statement_count;
 }
 
 void 
 _parser::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	std::vector<node> begin_stmt, end_stmt;
-	node begin_node(lexer::get_begin_token_id()),
-		end_node(lexer::get_end_token_id());
+	statement_t begin_stmt = { 0, 1, PARSER_END_STATEMENT, INVALID_STATEMENT_ID }, 
+		end_stmt = { 1, 2, INVALID_STATEMENT_ID, PARSER_BEGIN_STATEMENT };
 
-	lexer::reset();
-	begin_stmt.push_back(begin_node);
-	end_stmt.push_back(end_node);
+	lexer::clear();
+	_current = PARSER_BEGIN_STATEMENT;
 	_position = 0;
+	_node_pool.clear();
+	_node_pool.push_back(node(lexer::get_begin_token_id()));
+	_node_pool.push_back(node(lexer::get_end_token_id()));
 	_statement.clear();
 	_statement.push_back(begin_stmt);
 	_statement.push_back(end_stmt);
+	_statement_count = _statement.size();
 }
 
 void 
 _parser::discover(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	clear();
 
@@ -575,64 +700,77 @@ _parser::discover(void)
 	reset();
 }
 
-std::vector<std::vector<node>> 
+std::vector<node> 
 _parser::export_statements(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
+
+	size_t type;
+	nodeid_t base, id;
+	std::vector<node> result;
+	stmtid_t statement = PARSER_BEGIN_STATEMENT;
+	std::vector<tokid_t> index = lexer::_export_index();
 
-	token tok;
-	std::vector<std::vector<node>> result;
-	std::vector<std::vector<node>>::iterator statement_iter = _statement.begin();
+	result.reserve(_node_pool.size());
 	
-	for(; statement_iter != _statement.end(); ++statement_iter) {
-		tok = get_token(statement_iter->front().get_id());
+	for(; statement != INVALID_STATEMENT_ID; statement = _statement[statement].next) {
+		type = get_token_type(_node_pool[_statement[statement].begin].get_id());
 
-		if(tok.get_type() == TOKEN_BEGIN
-				|| tok.get_type() == TOKEN_END) {
+		if(type == TOKEN_BEGIN
+				|| type == TOKEN_END) {
 			continue;
 		}
-		result.push_back(*statement_iter);
+		base = (nodeid_t) result.size();
+
+		for(id = _statement[statement].begin; id < _statement[statement].end; ++id) {
+			result.push_back(_node_pool[id]);
+			result.back().rebase(_statement[statement].begin, base);
+			result.back().set_id(index.at(result.back().get_id()));
+		}
 	}
 
 	return result;
 }
 
-std::vector<node> &
-_parser::get_statement(void)
+const node & 
+_parser::get_node(
+	nodeid_t id
+	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	if(_position >= _statement.size()) {
+	if(id >= _node_pool.size()) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
-			PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
-			"pos. " << _position
+			PARSER_EXCEPTION_INVALID_NODE_POSITION,
+			"pos. " << id
 			);
 	}
 
-	return _statement.at(_position);
+	return _node_pool[id];
+}
+
+nodeid_t 
+_parser::get_statement(void)
+{
+	LOCK_OBJECT(object_lock_t, _parser_lock);
+
+	return _statement[_current].begin;
 }
 
-std::vector<node> &
+nodeid_t 
 _parser::get_statement(
 	size_t position
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
-
-	if(position >= _statement.size()) {
-		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
-			PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
-			"pos. " << position
-			);
-	}
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	return _statement.at(position);
+	return _statement[_find_statement(position)].begin;
 }
 
 size_t 
 _parser::get_statement_position(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	return _position;
 }
@@ -640,31 +778,44 @@ _parser::get_statement_position(void)
 bool 
 _parser::has_next_statement(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	return lexer::get_token(get_statement().front().get_id()).get_type() != TOKEN_END;
+	return lexer::get_token_type(_node_pool[get_statement()].get_id()) != TOKEN_END;
 }
 
 bool 
 _parser::has_previous_statement(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	return _position > 0; 
 }
 
 void 
 _parser::import_statements(
-	std::vector<std::vector<node>> statements
+	const std::vector<node> &statements,
+	tokid_t token_base
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
+
+	node imported;
+	nodeid_t node_base = (nodeid_t) _node_pool.size();
+	stmtid_t previous = _current, statement = INVALID_STATEMENT_ID;
+	std::vector<node>::const_iterator node_iter = statements.begin();
 
-	size_t offset = _position;
-	std::vector<std::vector<node>>::iterator statement_iter = statements.begin();
+	for(; node_iter != statements.end(); ++node_iter) {
+		imported = *node_iter;
 
-	for(; statement_iter != statements.end(); ++statement_iter) {
-		_statement.insert(_statement.begin() + (++offset), *statement_iter);
+		if(!imported.has_parent()) {
+			statement = _append_statement((nodeid_t) _node_pool.size());
+			_link_statement(statement, previous);
+			previous = statement;
+		}
+		imported.rebase(0, node_base);
+		imported.set_id(imported.get_id() + token_base);
+		_node_pool.push_back(imported);
+		_statement[statement].end = (nodeid_t) _node_pool.size();
 	}
 }
 
@@ -674,7 +825,7 @@ _parser::initialize(
 	bool is_file
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	lexer::initialize(input, is_file);
 	clear();
@@ -685,19 +836,35 @@ _parser::initialize(
 	const _parser &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	lexer::initialize(other);
+	_current = other._current;
+	_node_pool = other._node_pool;
 	_position = other._position;
 	_statement = other._statement;
+	_statement_count = other._statement_count;
 }
 
-std::vector<node> &
+void 
+_parser::initialize(
+	const _lexer_base &other,
+	size_t begin,
+	size_t end
+	)
+{
+	LOCK_OBJECT(object_lock_t, _parser_lock);
+
+	lexer::initialize(other, begin, end);
+	clear();
+}
+
+nodeid_t 
 _parser::move_next_statement(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	std::vector<node> statement;
+	stmtid_t statement;
 
 	if(!has_next_statement()) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -707,29 +874,34 @@ _parser::move_next_statement(void)
 	}
 
 	if(has_next_token()
-			&& _position == (_statement.size() - 2)) {
+			&& _position == (_statement_count - 2)) {
 
-		if(lexer::get_token().get_type() == TOKEN_BEGIN) {
+		if(lexer::get_token_view().get_type() == TOKEN_BEGIN) {
 			_advance_token();
 		}
 
 		if(has_next_token()) {
-			_enumerate_statement(statement);
-			_statement.insert(_statement.begin() + (++_position), statement);
+			statement = _append_statement((nodeid_t) _node_pool.size());
+			_enumerate_statement();
+			_statement[statement].end = (nodeid_t) _node_pool.size();
+			_link_statement(statement, _current);
+			_current = statement;
 		} else {
-			++_position;
+			_current = _statement[_current].next;
 		}
-	} else if(_position < (_statement.size() - 1)) {
+		++_position;
+	} else if(_position < (_statement_count - 1)) {
+		_current = _statement[_current].next;
 		++_position;
 	}
 
 	return get_statement();
 }
 
-std::vector<node> &
+nodeid_t 
 _parser::move_previous_statement(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	if(!has_previous_statement()) {
 		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
@@ -737,6 +909,7 @@ _parser::move_previous_statement(void)
 			"pos. " << _position
 			);
 	}
+	_current = _statement[_current].previous;
 	--_position;
 	
 	return get_statement();
@@ -745,7 +918,7 @@ _parser::move_previous_statement(void)
 void 
 _parser::remove_statement(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	remove_statement(_position);
 }
@@ -755,32 +928,32 @@ _parser::remove_statement(
 	size_t position
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	if(position >= _statement.size()) {
-		THROW_PARSER_EXCEPTION_WITH_MESSAGE(
-			PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
-			"pos. " << position
-			);
+	stmtid_t statement = _find_statement(position);
+
+	if(position >= _position) {
+		_current = _statement[_current].previous;
 	}
-	_statement.erase(_statement.begin() + position);
+	_unlink_statement(statement);
 	--_position;
 }
 
 void 
 _parser::reset(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
+	_current = PARSER_BEGIN_STATEMENT;
 	_position = 0;
 }
 
 size_t 
 _parser::size(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	return _statement.size() - 2;
+	return _statement_count - 2;
 }
 
 std::string 
@@ -788,7 +961,7 @@ _parser::statement_to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	return statement_to_string(_position, verbose);
 }
@@ -799,25 +972,23 @@ _parser::statement_to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
-	size_t i;
+	nodeid_t child;
 	std::stringstream ss;
-	std::queue<node> que;
-	std::vector<node> statement = get_statement(position);
+	std::queue<nodeid_t> que;
 
-	if(!statement.empty()) {
-		que.push(statement.front());
+	que.push(get_statement(position));
 
-		while(!que.empty()) {
-			ss << lexer::get_token(que.front().get_id()).to_string(verbose) 
-					<< que.front().to_string(false) << std::endl;
+	while(!que.empty()) {
+		ss << lexer::get_token(_node_pool[que.front()].get_id()).to_string(verbose) 
+				<< _node_pool[que.front()].to_string(false) << std::endl;
 
-			for(i = 0; i < que.front().size(); ++i) {
-				que.push(statement.at(que.front().get_child_position(i)));
-			}
-			que.pop();
+		for(child = _node_pool[que.front()].get_first_child(); child != INVALID_NODE_ID; 
+				child = _node_pool[child].get_next_sibling()) {
+			que.push(child);
 		}
+		que.pop();
 	}
 
 	return ss.str();
@@ -828,7 +999,7 @@ _parser::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _parser_lock);
+	LOCK_OBJECT(object_lock_t, _parser_lock);
 
 	std::stringstream ss;
 
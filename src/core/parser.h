@@ -24,6 +24,21 @@
 #include "node.h"
 #include "type.h"
 
+typedef struct _parser_chunk_t {
+	size_t begin;
+	bool complete;
+	size_t end;
+	std::exception_ptr error;
+	std::vector<node> statements;
+} parser_chunk_t, *parser_chunk_ptr;
+
+typedef struct _statement_t {
+	nodeid_t begin;
+	nodeid_t end;
+	stmtid_t next;
+	stmtid_t previous;
+} statement_t, *statement_ptr;
+
 typedef class _parser :
 		public lexer {
 
@@ -50,11 +65,15 @@ typedef class _parser :
 
 		virtual void discover(void);
 
-		std::vector<std::vector<node>> export_statements(void);
+		std::vector<node> export_statements(void);
+
+		const node &get_node(
+			nodeid_t id
+			);
 
-		std::vector<node> &get_statement(void);
+		nodeid_t get_statement(void);
 
-		std::vector<node> &get_statement(
+		nodeid_t get_statement(
 			size_t position
 			);
 
@@ -65,7 +84,8 @@ typedef class _parser :
 		bool has_previous_statement(void);
 
 		void import_statements(
-			std::vector<std::vector<node>> statements
+			const std::vector<node> &statements,
+			tokid_t token_base
 			);
 
 		virtual void initialize(
@@ -77,9 +97,15 @@ typedef class _parser :
 			const _parser &other
 			);
 
-		std::vector<node> &move_next_statement(void);
+		virtual void initialize(
+			const _lexer_base &other,
+			size_t begin,
+			size_t end
+			);
+
+		nodeid_t move_next_statement(void);
 
-		std::vector<node> &move_previous_statement(void);
+		nodeid_t move_previous_statement(void);
 
 		void remove_statement(void);
 
@@ -110,76 +136,92 @@ typedef class _parser :
 			bool expect_eos = false
 			);
 
-		size_t _append_token(
-			std::vector<node> &statement,
-			size_t parent_position = INVALID_TYPE
+		stmtid_t _append_statement(
+			nodeid_t begin
 			);
 
-		size_t _append_token(
-			const uuidl_t &id,
-			std::vector<node> &statement,
-			size_t parent_position = INVALID_TYPE
+		nodeid_t _append_token(
+			nodeid_t parent = INVALID_NODE_ID
 			);
 
-		void _enumerate_command(
-			std::vector<node> &statement
+		nodeid_t _append_token(
+			tokid_t id,
+			nodeid_t parent
 			);
 
-		void _enumerate_directive(
-			std::vector<node> &statement
+		static void _discover_chunk(
+			_parser &worker,
+			parser_chunk_t &chunk
 			);
 
-		void _enumerate_label(
-			std::vector<node> &statement
-			);
+		void _enumerate_command(void);
+
+		void _enumerate_directive(void);
+
+		void _enumerate_label(void);
 
 		void _enumerate_operand(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
 			);
 
 		void _enumerate_operand_a(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
 			);
 
 		void _enumerate_operand_b(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
 			);
 
-		void _enumerate_statement(
-			std::vector<node> &statement
-			);
+		void _enumerate_statement(void);
 
 		void _enumerate_static_value(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
 			);
 
 		void _enumerate_value(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
 			);
 
 		void _enumerate_value_list(
-			std::vector<node> &statement,
-			size_t parent_position
+			nodeid_t parent
+			);
+
+		stmtid_t _find_statement(
+			size_t position
+			);
+
+		void _link_statement(
+			stmtid_t id,
+			stmtid_t previous
 			);
 
 		void _set_operand_mode(
-			std::vector<node> &statement,
-			size_t operand_position,
+			nodeid_t operand,
 			size_t mode
 			);
 
+		std::vector<lexer_boundary_t> _split_statements(
+			size_t end,
+			size_t count
+			);
+
+		void _unlink_statement(
+			stmtid_t id
+			);
+
+		stmtid_t _current;
+
+		std::vector<node> _node_pool;
+
 		size_t _position;
 
-		std::vector<std::vector<node>> _statement;
+		std::vector<statement_t> _statement;
+
+		size_t _statement_count;
 
 	private:
 
-		std::recursive_mutex _parser_lock;
+		object_lock_t _parser_lock;
 
 } parser, *parser_ptr;
 
@@ -38,6 +38,7 @@ enum {
 	PARSER_EXCEPTION_EXPECTED_VALUE,
 	PARSER_EXCEPTION_ILLEGAL_OPERATOR,
 	PARSER_EXCEPTION_ILLEGAL_SYSTEM_REGISTER,
+	PARSER_EXCEPTION_INVALID_NODE_POSITION,
 	PARSER_EXCEPTION_INVALID_OPERAND_POSITION,
 	PARSER_EXCEPTION_INVALID_PARENT_POSITION,
 	PARSER_EXCEPTION_INVALID_STATEMENT_POSITION,
@@ -62,6 +63,7 @@ static const std::string PARSER_EXCEPTION_STR[] = {
 	"Expected value",
 	"Illegal operator",
 	"Illegal system register",
+	"Invalid node position",
 	"Invalid operand position",
 	"Invalid parent position",
 	"Invalid statement position",
@@ -70,6 +72,10 @@ static const std::string PARSER_EXCEPTION_STR[] = {
 	"Unexpected end of token stream",
 };
 
+#define PARSER_BEGIN_STATEMENT ((stmtid_t) 0)
+#define PARSER_CHUNK_LENGTH_MIN 0x40000
+#define PARSER_END_STATEMENT ((stmtid_t) 1)
+
 #define MAX_PARSER_EXCEPTION PARSER_EXCEPTION_UNEXPECTED_END_OF_TOKEN_STREAM
 #define PARSER_EXCEPTION_HEADER "PARSER"
 #define SHOW_PARSER_EXCEPTION_HEADER true
@@ -0,0 +1,444 @@
+/*
+ * source.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstring>
+#include "lexer_base_type.h"
+#include "source.h"
+#include "source_type.h"
+
+_source::_source(void) :
+	_line_indexed(false),
+	_mapped(false),
+	_size(0)
+{
+	clear();
+}
+
+_source::_source(
+	const std::string &input,
+	bool is_file
+	) :
+		_line_indexed(false),
+		_mapped(false),
+		_size(0)
+{
+	initialize(input, is_file);
+}
+
+_source::_source(
+	const _source &other
+	) :
+		_line_indexed(false),
+		_mapped(false),
+		_size(0)
+{
+	initialize(other);
+}
+
+_source::~_source(void)
+{
+	_unmap_file();
+}
+
+_source &
+_source::operator=(
+	const _source &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	if(this != &other) {
+		initialize(other);
+	}
+
+	return *this;
+}
+
+void 
+_source::_index_lines(void)
+{
+	size_t position = 0;
+	const char *newline;
+#ifdef SIMD_SSE2
+	uint32_t mask;
+	__m128i newline_block = _mm_set1_epi8(CHARACTER_NEWLINE);
+#endif
+
+	_line_position.clear();
+	_line_position.push_back(0);
+#ifdef SIMD_SSE2
+
+	for(; (position + sizeof(__m128i)) <= _size; position += sizeof(__m128i)) {
+		mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *) (_data + position)), newline_block));
+
+		while(mask) {
+			_line_position.push_back(position + __trailing_zero_count(mask) + 1);
+			mask &= (mask - 1);
+		}
+	}
+#endif
+
+	while(position < _size) {
+		newline = (const char *) memchr(_data + position, CHARACTER_NEWLINE, _size - position);
+
+		if(!newline) {
+			break;
+		}
+		position = (newline - _data) + 1;
+		_line_position.push_back(position);
+	}
+	_line_indexed = true;
+}
+
+void 
+_source::_map_file(
+	const std::string &path
+	)
+{
+#ifdef _WIN32
+	HANDLE file, mapping;
+	LARGE_INTEGER length;
+
+	file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, 
+		OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if(file == INVALID_HANDLE_VALUE) {
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_FILE_NOT_FOUND,
+			"\'" << path << "\'"
+			);
+	}
+
+	if(!GetFileSizeEx(file, &length)) {
+		CloseHandle(file);
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_FILE_MAP_FAILED,
+			"\'" << path << "\'"
+			);
+	}
+
+	if(length.QuadPart) {
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+		if(mapping) {
+			_data = (const char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+		CloseHandle(file);
+
+		if(!mapping
+				|| !_data) {
+			_data = _input.c_str();
+			THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+				SOURCE_EXCEPTION_FILE_MAP_FAILED,
+				"\'" << path << "\'"
+				);
+		}
+		_mapped = true;
+		_size = (size_t) length.QuadPart;
+	} else {
+		CloseHandle(file);
+	}
+#else
+	void *data;
+	struct stat status;
+	int file = open(path.c_str(), O_RDONLY);
+
+	if(file < 0) {
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_FILE_NOT_FOUND,
+			"\'" << path << "\'"
+			);
+	}
+
+	if(fstat(file, &status)) {
+		close(file);
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_FILE_MAP_FAILED,
+			"\'" << path << "\'"
+			);
+	}
+
+	if(status.st_size) {
+		data = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+
+		if(data == MAP_FAILED) {
+			THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+				SOURCE_EXCEPTION_FILE_MAP_FAILED,
+				"\'" << path << "\'"
+				);
+		}
+		madvise(data, (size_t) status.st_size, MADV_SEQUENTIAL);
+		_data = (const char *) data;
+		_mapped = true;
+		_size = (size_t) status.st_size;
+	} else {
+		close(file);
+	}
+#endif
+}
+
+void 
+_source::_unmap_file(void)
+{
+
+	if(_mapped) {
+#ifdef _WIN32
+		UnmapViewOfFile((LPCVOID) _data);
+#else
+		munmap((void *) _data, _size);
+#endif
+		_mapped = false;
+	}
+}
+
+void 
+_source::clear(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	_unmap_file();
+	_input.clear();
+	_data = _input.c_str();
+	_line_indexed = false;
+	_line_position.clear();
+	_path.clear();
+	_size = 0;
+}
+
+const char *
+_source::get_data(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	return _data;
+}
+
+size_t 
+_source::get_line(
+	size_t position,
+	size_t &hint
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	size_t count = 0;
+
+	if(!_line_indexed) {
+		_index_lines();
+	}
+
+	if(hint >= _line_position.size()
+			|| position < _line_position.at(hint)) {
+		hint = 0;
+	}
+
+	while((hint + 1) < _line_position.size()
+			&& position >= _line_position.at(hint + 1)) {
+
+		if(++count > SOURCE_LINE_SEARCH_LENGTH) {
+			hint = (std::upper_bound(_line_position.begin() + hint, _line_position.end(), position) 
+				- _line_position.begin()) - 1;
+			break;
+		}
+		++hint;
+	}
+
+	return hint;
+}
+
+size_t 
+_source::get_line_count(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	if(!_line_indexed) {
+		_index_lines();
+	}
+
+	return _line_position.size();
+}
+
+size_t 
+_source::get_line_position(
+	size_t line
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	if(!_line_indexed) {
+		_index_lines();
+	}
+
+	if(line >= _line_position.size()) {
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_INVALID_LINE,
+			"ln. " << line
+			);
+	}
+
+	return _line_position.at(line);
+}
+
+std::string 
+_source::get_path(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	return _path;
+}
+
+void 
+_source::initialize(
+	const std::string &input,
+	bool is_file
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	clear();
+
+	if(is_file) {
+		_map_file(input);
+		_path = input;
+	} else {
+		_input = input;
+		_data = _input.c_str();
+		_size = _input.size();
+	}
+}
+
+void 
+_source::initialize(
+	const _source &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	clear();
+
+	if(other._mapped) {
+		_map_file(other._path);
+	} else {
+		_input = other._input;
+		_data = _input.c_str();
+		_size = _input.size();
+	}
+	_line_indexed = other._line_indexed;
+	_line_position = other._line_position;
+	_path = other._path;
+}
+
+bool 
+_source::is_mapped(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	return _mapped;
+}
+
+void 
+_source::replace(
+	size_t position,
+	size_t length,
+	const std::string &text
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	size_t offset;
+	std::vector<size_t> line_position;
+	std::vector<size_t>::iterator begin_iter, end_iter, line_iter;
+
+	if(position > _size
+			|| length > (_size - position)) {
+		THROW_SOURCE_EXCEPTION_WITH_MESSAGE(
+			SOURCE_EXCEPTION_INVALID_POSITION,
+			"pos. " << position << ", len. " << length
+			);
+	}
+
+	if(!_line_indexed) {
+		_index_lines();
+	}
+
+	for(offset = 0; offset < text.size(); ++offset) {
+
+		if(text.at(offset) == CHARACTER_NEWLINE) {
+			line_position.push_back(position + offset + 1);
+		}
+	}
+	begin_iter = std::upper_bound(_line_position.begin(), _line_position.end(), position);
+	end_iter = std::upper_bound(begin_iter, _line_position.end(), position + length);
+
+	for(line_iter = end_iter; line_iter != _line_position.end(); ++line_iter) {
+		*line_iter = (*line_iter + text.size()) - length;
+	}
+	begin_iter = _line_position.erase(begin_iter, end_iter);
+	_line_position.insert(begin_iter, line_position.begin(), line_position.end());
+
+	if(_mapped) {
+		_input.assign(_data, _size);
+		_unmap_file();
+	}
+	_input.replace(position, length, text);
+	_data = _input.c_str();
+	_size = _input.size();
+}
+
+size_t 
+_source::size(void)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	return _size;
+}
+
+std::string 
+_source::to_string(
+	bool verbose
+	)
+{
+	LOCK_OBJECT(object_lock_t, _source_lock);
+
+	std::stringstream ss;
+
+	if(verbose) {
+		ss << "[" << (_mapped ? "MAPPED" : "BUFFERED") << "] ";
+	}
+
+	if(!_path.empty()) {
+		ss << "src. \'" << _path << "\' ";
+	}
+	ss << "(" << _size << " bytes)";
+
+	return ss.str();
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*
+ * source.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SOURCE_H_
+#define SOURCE_H_
+
+#include <vector>
+#include "type.h"
+
+typedef class _source {
+
+	public:
+
+		_source(void);
+
+		_source(
+			const std::string &input,
+			bool is_file
+			);
+
+		_source(
+			const _source &other
+			);
+
+		virtual ~_source(void);
+
+		_source &operator=(
+			const _source &other
+			);
+
+		virtual void clear(void);
+
+		const char *get_data(void);
+
+		size_t get_line(
+			size_t position,
+			size_t &hint
+			);
+
+		size_t get_line_count(void);
+
+		size_t get_line_position(
+			size_t line
+			);
+
+		std::string get_path(void);
+
+		virtual void initialize(
+			const std::string &input,
+			bool is_file
+			);
+
+		virtual void initialize(
+			const _source &other
+			);
+
+		bool is_mapped(void);
+
+		void replace(
+			size_t position,
+			size_t length,
+			const std::string &text
+			);
+
+		virtual size_t size(void);
+
+		virtual std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		void _index_lines(void);
+
+		void _map_file(
+			const std::string &path
+			);
+
+		void _unmap_file(void);
+
+		const char *_data;
+
+		std::string _input;
+
+		bool _line_indexed;
+
+		std::vector<size_t> _line_position;
+
+		bool _mapped;
+
+		std::string _path;
+
+		size_t _size;
+
+	private:
+
+		object_lock_t _source_lock;
+
+} source, *source_ptr;
+
+#endif
\ No newline at end of file
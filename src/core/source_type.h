@@ -0,0 +1,54 @@
+/*
+ * source_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SOURCE_TYPE_H_
+#define SOURCE_TYPE_H_
+
+#include "type.h"
+
+enum {
+	SOURCE_EXCEPTION_FILE_NOT_FOUND = 0,
+	SOURCE_EXCEPTION_FILE_MAP_FAILED,
+	SOURCE_EXCEPTION_INVALID_LINE,
+	SOURCE_EXCEPTION_INVALID_POSITION,
+};
+
+static const std::string SOURCE_EXCEPTION_STR[] = {
+	"File not found",
+	"Failed to map file",
+	"Invalid line",
+	"Invalid position",
+};
+
+#define MAX_SOURCE_EXCEPTION SOURCE_EXCEPTION_INVALID_POSITION
+#define SHOW_SOURCE_EXCEPTION_HEADER true
+#define SOURCE_LINE_SEARCH_LENGTH (4)
+#define SOURCE_EXCEPTION_HEADER "SOURCE"
+
+#define SOURCE_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_SOURCE_EXCEPTION ? UNKNOWN_EXCEPTION : SOURCE_EXCEPTION_STR[_T_])
+#define THROW_SOURCE_EXCEPTION(_T_)\
+	THROW_EXCEPTION(SOURCE_EXCEPTION_HEADER, SOURCE_EXCEPTION_STRING(_T_), SHOW_SOURCE_EXCEPTION_HEADER)
+#define THROW_SOURCE_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(SOURCE_EXCEPTION_HEADER, SOURCE_EXCEPTION_STRING(_T_), _M_, SHOW_SOURCE_EXCEPTION_HEADER)
+
+class _source;
+typedef _source source, *source_ptr;
+
+#endif
\ No newline at end of file
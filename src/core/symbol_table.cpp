@@ -0,0 +1,250 @@
+/*
+ * symbol_table.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "symbol_table.h"
+#include "symbol_table_type.h"
+
+_symbol_table::_symbol_table(void)
+{
+	clear();
+}
+
+_symbol_table::_symbol_table(
+	const _symbol_table &other
+	) :
+		_hash_value(other._hash_value),
+		_slot(other._slot),
+		_text_length(other._text_length),
+		_text_offset(other._text_offset),
+		_text_pool(other._text_pool)
+{
+	return;
+}
+
+_symbol_table::~_symbol_table(void)
+{
+	return;
+}
+
+_symbol_table &
+_symbol_table::operator=(
+	const _symbol_table &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	if(this != &other) {
+		_hash_value = other._hash_value;
+		_slot = other._slot;
+		_text_length = other._text_length;
+		_text_offset = other._text_offset;
+		_text_pool = other._text_pool;
+	}
+
+	return *this;
+}
+
+size_t 
+_symbol_table::_find_slot(
+	const char *data,
+	size_t length,
+	uint32_t hash
+	)
+{
+	symid_t id;
+	size_t mask = _slot.size() - 1, result = hash & mask;
+
+	for(;;) {
+		id = _slot[result];
+
+		if(id == INVALID_SYMBOL_ID
+				|| (_hash_value[id] == hash
+				&& _text_length[id] == length
+				&& !_text_pool.compare(_text_offset[id], length, data, length))) {
+			break;
+		}
+		result = (result + 1) & mask;
+	}
+
+	return result;
+}
+
+void 
+_symbol_table::_grow(void)
+{
+	symid_t id = 0;
+	size_t mask, position;
+
+	_slot.assign(_slot.size() * 2, INVALID_SYMBOL_ID);
+	mask = _slot.size() - 1;
+
+	for(; id < _hash_value.size(); ++id) {
+		position = _hash_value[id] & mask;
+
+		while(_slot[position] != INVALID_SYMBOL_ID) {
+			position = (position + 1) & mask;
+		}
+		_slot[position] = id;
+	}
+}
+
+uint32_t 
+_symbol_table::_hash(
+	const char *data,
+	size_t length
+	)
+{
+	size_t position = 0;
+	uint32_t result = SYMBOL_TABLE_HASH_BASIS;
+
+	for(; position < length; ++position) {
+		result = (result ^ (byte_t) data[position]) * SYMBOL_TABLE_HASH_PRIME;
+	}
+
+	return result;
+}
+
+void 
+_symbol_table::_validate_id(
+	symid_t id
+	)
+{
+
+	if(id >= _hash_value.size()) {
+		THROW_SYMBOL_TABLE_EXCEPTION_WITH_MESSAGE(
+			SYMBOL_TABLE_EXCEPTION_INVALID_ID,
+			"{" << id << "}"
+			);
+	}
+}
+
+void 
+_symbol_table::clear(void)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	_hash_value.clear();
+	_slot.assign(SYMBOL_TABLE_SLOT_COUNT_MIN, INVALID_SYMBOL_ID);
+	_text_length.clear();
+	_text_offset.clear();
+	_text_pool.clear();
+}
+
+symid_t 
+_symbol_table::find(
+	const char *data,
+	size_t length
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	return _slot[_find_slot(data, length, _hash(data, length))];
+}
+
+std::string 
+_symbol_table::get_text(
+	symid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	_validate_id(id);
+
+	return _text_pool.substr(_text_offset[id], _text_length[id]);
+}
+
+const char * 
+_symbol_table::get_text_data(
+	symid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	_validate_id(id);
+
+	return _text_pool.c_str() + _text_offset[id];
+}
+
+size_t 
+_symbol_table::get_text_length(
+	symid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	_validate_id(id);
+
+	return _text_length[id];
+}
+
+symid_t 
+_symbol_table::intern(
+	const char *data,
+	size_t length
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	uint32_t hash = _hash(data, length);
+	size_t position = _find_slot(data, length, hash);
+	symid_t result = _slot[position];
+
+	if(result == INVALID_SYMBOL_ID) {
+		result = (symid_t) _hash_value.size();
+		_hash_value.push_back(hash);
+		_text_length.push_back((uint32_t) length);
+		_text_offset.push_back((uint32_t) _text_pool.size());
+		_text_pool.append(data, length);
+
+		if((_hash_value.size() * 2) > _slot.size()) {
+			_grow();
+		} else {
+			_slot[position] = result;
+		}
+	}
+
+	return result;
+}
+
+size_t 
+_symbol_table::size(void)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	return _hash_value.size();
+}
+
+std::string 
+_symbol_table::to_string(
+	bool verbose
+	)
+{
+	LOCK_OBJECT(object_lock_t, _symbol_table_lock);
+
+	std::stringstream ss;
+
+	ss << "(" << _hash_value.size() << " symbols";
+
+	if(verbose) {
+		ss << ", " << _slot.size() << " slots, " << _text_pool.size() << " pooled bytes";
+	}
+	ss << ")";
+
+	return ss.str();
+}
\ No newline at end of file
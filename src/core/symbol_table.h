@@ -0,0 +1,107 @@
+/*
+ * symbol_table.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYMBOL_TABLE_H_
+#define SYMBOL_TABLE_H_
+
+#include <vector>
+#include "type.h"
+
+typedef class _symbol_table {
+
+	public:
+
+		_symbol_table(void);
+
+		_symbol_table(
+			const _symbol_table &other
+			);
+
+		virtual ~_symbol_table(void);
+
+		_symbol_table &operator=(
+			const _symbol_table &other
+			);
+
+		virtual void clear(void);
+
+		symid_t find(
+			const char *data,
+			size_t length
+			);
+
+		std::string get_text(
+			symid_t id
+			);
+
+		const char *get_text_data(
+			symid_t id
+			);
+
+		size_t get_text_length(
+			symid_t id
+			);
+
+		symid_t intern(
+			const char *data,
+			size_t length
+			);
+
+		virtual size_t size(void);
+
+		virtual std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		size_t _find_slot(
+			const char *data,
+			size_t length,
+			uint32_t hash
+			);
+
+		void _grow(void);
+
+		static uint32_t _hash(
+			const char *data,
+			size_t length
+			);
+
+		void _validate_id(
+			symid_t id
+			);
+
+		std::vector<uint32_t> _hash_value;
+
+		std::vector<symid_t> _slot;
+
+		std::vector<uint32_t> _text_length;
+
+		std::vector<uint32_t> _text_offset;
+
+		std::string _text_pool;
+
+	private:
+
+		object_lock_t _symbol_table_lock;
+
+} symbol_table, *symbol_table_ptr;
+
+#endif
\ No newline at end of file
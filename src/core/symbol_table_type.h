@@ -0,0 +1,50 @@
+/*
+ * symbol_table_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYMBOL_TABLE_TYPE_H_
+#define SYMBOL_TABLE_TYPE_H_
+
+#include "type.h"
+
+enum {
+	SYMBOL_TABLE_EXCEPTION_INVALID_ID = 0,
+};
+
+static const std::string SYMBOL_TABLE_EXCEPTION_STR[] = {
+	"Invalid symbol id",
+};
+
+#define MAX_SYMBOL_TABLE_EXCEPTION SYMBOL_TABLE_EXCEPTION_INVALID_ID
+#define SHOW_SYMBOL_TABLE_EXCEPTION_HEADER true
+#define SYMBOL_TABLE_EXCEPTION_HEADER "SYMBOL TABLE"
+#define SYMBOL_TABLE_HASH_BASIS (0x811c9dc5)
+#define SYMBOL_TABLE_HASH_PRIME (0x01000193)
+#define SYMBOL_TABLE_SLOT_COUNT_MIN (0x400)
+
+#define SYMBOL_TABLE_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_SYMBOL_TABLE_EXCEPTION ? UNKNOWN_EXCEPTION : SYMBOL_TABLE_EXCEPTION_STR[_T_])
+#define THROW_SYMBOL_TABLE_EXCEPTION(_T_)\
+	THROW_EXCEPTION(SYMBOL_TABLE_EXCEPTION_HEADER, SYMBOL_TABLE_EXCEPTION_STRING(_T_), SHOW_SYMBOL_TABLE_EXCEPTION_HEADER)
+#define THROW_SYMBOL_TABLE_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(SYMBOL_TABLE_EXCEPTION_HEADER, SYMBOL_TABLE_EXCEPTION_STRING(_T_), _M_, SHOW_SYMBOL_TABLE_EXCEPTION_HEADER)
+
+class _symbol_table;
+typedef _symbol_table symbol_table, *symbol_table_ptr;
+
+#endif
\ No newline at end of file
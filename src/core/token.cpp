@@ -23,7 +23,7 @@
 #include "token_type.h"
 
 _token::_token(void) :
-	_id(uuid::generate_long_id(false))
+	_id(INVALID_TOKEN_ID)
 {
 	clear();
 }
@@ -31,11 +31,14 @@ _token::_token(void) :
 _token::_token(
 	size_t type
 	) :
-		_id(uuid::generate_long_id(false)),
+		_id(INVALID_TOKEN_ID),
 		_line(INVALID_TYPE),
 		_mode(INVALID_TYPE),
 		_subtype(INVALID_TYPE),
-		_type(type)
+		_text_data(NULL),
+		_text_length(0),
+		_type(type),
+		_value(0)
 {
 	return;
 }
@@ -44,11 +47,34 @@ _token::_token(
 	size_t type,
 	size_t subtype
 	) :
-		_id(uuid::generate_long_id(false)),
+		_id(INVALID_TOKEN_ID),
 		_line(INVALID_TYPE),
 		_mode(INVALID_TYPE),
 		_subtype(subtype),
-		_type(type)
+		_text_data(NULL),
+		_text_length(0),
+		_type(type),
+		_value(0)
+{
+	return;
+}
+
+_token::_token(
+	tokid_t id,
+	size_t type,
+	size_t subtype,
+	size_t mode,
+	size_t line,
+	size_t value
+	) :
+		_id(id),
+		_line(line),
+		_mode(mode),
+		_subtype(subtype),
+		_text_data(NULL),
+		_text_length(0),
+		_type(type),
+		_value(value)
 {
 	return;
 }
@@ -62,7 +88,10 @@ _token::_token(
 		_origin(other._origin),
 		_subtype(other._subtype),
 		_text(other._text),
-		_type(other._type)
+		_text_data(other._text_data),
+		_text_length(other._text_length),
+		_type(other._type),
+		_value(other._value)
 {
 
 }
@@ -77,7 +106,7 @@ _token::operator=(
 	const _token &other
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	if(this != &other) {
 		_id = other._id;
@@ -86,7 +115,10 @@ _token::operator=(
 		_origin = other._origin;
 		_subtype = other._subtype;
 		_text = other._text;
+		_text_data = other._text_data;
+		_text_length = other._text_length;
 		_type = other._type;
+		_value = other._value;
 	}
 
 	return *this;
@@ -95,20 +127,23 @@ _token::operator=(
 void 
 _token::clear(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_line = INVALID_TYPE;
 	_mode = INVALID_TYPE;
 	_origin.clear();
 	_subtype = INVALID_TYPE;
 	_text.clear();
+	_text_data = NULL;
+	_text_length = 0;
 	_type = INVALID_TYPE;
+	_value = 0;
 }
 
-uuidl_t 
+tokid_t 
 _token::get_id(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _id;
 }
@@ -116,7 +151,7 @@ _token::get_id(void)
 size_t 
 _token::get_line(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 	
 	return _line;
 }
@@ -124,7 +159,7 @@ _token::get_line(void)
 size_t 
 _token::get_mode(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _mode;
 }
@@ -132,7 +167,7 @@ _token::get_mode(void)
 std::string &
 _token::get_origin(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _origin;
 }
@@ -140,7 +175,7 @@ _token::get_origin(void)
 size_t 
 _token::get_subtype(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _subtype;
 }
@@ -148,23 +183,49 @@ _token::get_subtype(void)
 std::string &
 _token::get_text(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	own_text();
 
 	return _text;
 }
 
+const char *
+_token::get_text_data(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	return _text_data ? _text_data : _text.c_str();
+}
+
+size_t 
+_token::get_text_length(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	return _text_data ? _text_length : _text.size();
+}
+
 size_t 
 _token::get_type(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _type;
 }
 
+size_t 
+_token::get_value(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	return _value;
+}
+
 bool 
 _token::has_mode(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return _mode != INVALID_TYPE;
 }
@@ -172,7 +233,7 @@ _token::has_mode(void)
 bool 
 _token::has_origin(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	return !_origin.empty();
 }
@@ -180,9 +241,39 @@ _token::has_origin(void)
 bool 
 _token::has_text(void)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	return _text_length || !_text.empty();
+}
+
+bool 
+_token::is_text_view(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	return _text_data != NULL;
+}
+
+void 
+_token::own_text(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	if(_text_data) {
+		_text.assign(_text_data, _text_length);
+		_text_data = NULL;
+		_text_length = 0;
+	}
+}
+
+void 
+_token::set_id(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
-	return !_text.empty();
+	_id = id;
 }
 
 void 
@@ -190,7 +281,7 @@ _token::set_line(
 	size_t line
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_line = line;
 }
@@ -200,7 +291,7 @@ _token::set_mode(
 	size_t mode
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_mode = mode;
 }
@@ -210,7 +301,7 @@ _token::set_origin(
 	const std::string &origin
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_origin = origin;
 }
@@ -220,7 +311,7 @@ _token::set_subtype(
 	size_t subtype
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_subtype = subtype;
 }
@@ -230,9 +321,24 @@ _token::set_text(
 	const std::string &text
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_text = text;
+	_text_data = NULL;
+	_text_length = 0;
+}
+
+void 
+_token::set_text_view(
+	const char *data,
+	size_t length
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	_text.clear();
+	_text_data = data;
+	_text_length = length;
 }
 
 void 
@@ -240,22 +346,32 @@ _token::set_type(
 	size_t type
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	_type = type;
 }
 
+void 
+_token::set_value(
+	size_t value
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_lock);
+
+	_value = value;
+}
+
 std::string 
 _token::to_string(
 	bool verbose
 	)
 {
-	LOCK_OBJECT(std::recursive_mutex, _token_lock);
+	LOCK_OBJECT(object_lock_t, _token_lock);
 
 	std::stringstream ss;
 
 	if(verbose) {
-		ss << "{" << LONG_ID_AS_STRING(_id) << "} ";
+		ss << "{" << _id << "} ";
 	}
 	ss << "[" << TOKEN_STRING(_type);
 
@@ -270,7 +386,15 @@ _token::to_string(
 	}
 	ss << "]";
 
-	if(!_text.empty()
+	if(_text_data) {
+
+		if(_text_length
+				&& _text_data[0] != CHARACTER_END_STREAM) {
+			ss << " \'";
+			ss.write(_text_data, _text_length);
+			ss << "\'";
+		}
+	} else if(!_text.empty()
 			&& _text.front() != CHARACTER_END_STREAM) {
 		ss << " \'" << _text << "\'";;
 	}
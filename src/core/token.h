@@ -21,7 +21,6 @@
 #define TOKEN_H_
 
 #include "type.h"
-#include "uuid.h"
 
 typedef class _token {
 
@@ -38,6 +37,15 @@ typedef class _token {
 			size_t subtype
 			);
 
+		_token(
+			tokid_t id,
+			size_t type,
+			size_t subtype,
+			size_t mode,
+			size_t line,
+			size_t value
+			);
+
 		_token(
 			const _token &other
 			);
@@ -50,7 +58,7 @@ typedef class _token {
 
 		virtual void clear(void);
 
-		uuidl_t get_id(void);
+		tokid_t get_id(void);
 
 		size_t get_line(void);
 
@@ -62,14 +70,28 @@ typedef class _token {
 
 		std::string &get_text(void);
 
+		const char *get_text_data(void);
+
+		size_t get_text_length(void);
+
 		size_t get_type(void);
 
+		size_t get_value(void);
+
 		bool has_mode(void);
 
 		bool has_origin(void);
 
 		bool has_text(void);
 
+		bool is_text_view(void);
+
+		void own_text(void);
+
+		void set_id(
+			tokid_t id
+			);
+
 		void set_line(
 			size_t line
 			);
@@ -90,17 +112,26 @@ typedef class _token {
 			const std::string &text
 			);
 
+		void set_text_view(
+			const char *data,
+			size_t length
+			);
+
 		void set_type(
 			size_t type
 			);
 
+		void set_value(
+			size_t value
+			);
+
 		virtual std::string to_string(
 			bool verbose
 			);
 
 	protected:
 
-		uuidl_t _id;
+		tokid_t _id;
 
 		size_t _line;
 
@@ -112,11 +143,17 @@ typedef class _token {
 
 		std::string _text;
 
+		const char *_text_data;
+
+		size_t _text_length;
+
 		size_t _type;
 
+		size_t _value;
+
 	private:
 
-		std::recursive_mutex _token_lock;
+		object_lock_t _token_lock;
 
 } token, *token_ptr;
 
@@ -0,0 +1,706 @@
+/*
+ * token_store.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include "lang_def.h"
+#include "token_store.h"
+#include "token_store_type.h"
+
+_token_store::_token_store(void) :
+	_source(NULL),
+	_text_viewed(false)
+{
+	clear();
+}
+
+_token_store::_token_store(
+	const _token_store &other
+	) :
+		_flag(other._flag),
+		_line(other._line),
+		_line_block(other._line_block),
+		_mode(other._mode),
+		_origin_begin(other._origin_begin),
+		_origin_run(other._origin_run),
+		_origin_table(other._origin_table),
+		_source(other._source),
+		_subtype(other._subtype),
+		_symbol(other._symbol),
+		_text_length(other._text_length),
+		_text_offset(other._text_offset),
+		_text_pool(other._text_pool),
+		_text_viewed(other._text_viewed),
+		_type(other._type),
+		_value(other._value)
+{
+	return;
+}
+
+_token_store::~_token_store(void)
+{
+	return;
+}
+
+_token_store &
+_token_store::operator=(
+	const _token_store &other
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	if(this != &other) {
+		_flag = other._flag;
+		_line = other._line;
+		_line_block = other._line_block;
+		_mode = other._mode;
+		_origin_begin = other._origin_begin;
+		_origin_run = other._origin_run;
+		_origin_table = other._origin_table;
+		_source = other._source;
+		_subtype = other._subtype;
+		_symbol = other._symbol;
+		_text_length = other._text_length;
+		_text_offset = other._text_offset;
+		_text_pool = other._text_pool;
+		_text_viewed = other._text_viewed;
+		_type = other._type;
+		_value = other._value;
+	}
+
+	return *this;
+}
+
+uint32_t 
+_token_store::_find_origin(
+	tokid_t id
+	)
+{
+	std::vector<tokid_t>::iterator run_iter = std::upper_bound(_origin_begin.begin(), 
+		_origin_begin.end(), id);
+
+	return _origin_run.at((run_iter - _origin_begin.begin()) - 1);
+}
+
+uint32_t 
+_token_store::_intern_origin(
+	const std::string &origin
+	)
+{
+	uint32_t result;
+
+	if(!_origin_run.empty()
+			&& _origin_table[_origin_run.back()] == origin) {
+		return _origin_run.back();
+	}
+
+	for(result = 0; result < _origin_table.size(); ++result) {
+
+		if(_origin_table.at(result) == origin) {
+			return result;
+		}
+	}
+	_origin_table.push_back(origin);
+
+	return result;
+}
+
+size_t 
+_token_store::_line_value(
+	tokid_t id
+	)
+{
+	size_t result = TOKEN_STORE_FIELD_VALUE(uint32_t, _line[id]);
+
+	if(result != INVALID_TYPE) {
+		result += _line_block[id / TOKEN_STORE_LINE_BLOCK_LENGTH].shift;
+	}
+
+	return result;
+}
+
+void 
+_token_store::_push_line(
+	size_t line,
+	uint32_t origin
+	)
+{
+	token_store_block_ptr current;
+	token_store_block_t block = { 0, UINT32_MAX, origin, 0 };
+
+	if(!(_line.size() % TOKEN_STORE_LINE_BLOCK_LENGTH)) {
+		_line_block.push_back(block);
+	}
+	_line.push_back(TOKEN_STORE_FIELD(uint32_t, line));
+
+	if(line != INVALID_TYPE) {
+		current = &_line_block.back();
+
+		if(current->line_min > current->line_max) {
+			current->origin = origin;
+		} else if(current->origin != origin) {
+			current->origin = TOKEN_STORE_ORIGIN_MIXED;
+		}
+		current->line_max = std::max(current->line_max, (uint32_t) line);
+		current->line_min = std::min(current->line_min, (uint32_t) line);
+	}
+}
+
+void 
+_token_store::_shift_block(
+	size_t block,
+	uint32_t origin,
+	size_t line,
+	long delta
+	)
+{
+	bool match;
+	tokid_t id = (tokid_t) (block * TOKEN_STORE_LINE_BLOCK_LENGTH);
+	token_store_block_t &current = _line_block[block];
+	tokid_t end = (tokid_t) std::min(_line.size(), (size_t) id + TOKEN_STORE_LINE_BLOCK_LENGTH);
+
+	current.line_max = 0;
+	current.line_min = UINT32_MAX;
+
+	for(; id < end; ++id) {
+
+		if(TOKEN_STORE_FIELD_VALUE(uint32_t, _line[id]) == INVALID_TYPE) {
+			continue;
+		}
+
+		if(current.origin != TOKEN_STORE_ORIGIN_MIXED) {
+			match = true;
+		} else if(_flag[id] & TOKEN_STORE_FLAG_ORIGIN_NONE) {
+			match = (origin == TOKEN_STORE_ORIGIN_NONE);
+		} else {
+			match = (_find_origin(id) == origin);
+		}
+
+		if(match
+				&& ((long) _line[id] + current.shift) >= (long) line) {
+			_line[id] = (uint32_t) (_line[id] + delta);
+		}
+		current.line_max = std::max(current.line_max, _line[id]);
+		current.line_min = std::min(current.line_min, _line[id]);
+	}
+}
+
+void 
+_token_store::_validate_id(
+	tokid_t id
+	)
+{
+
+	if(id >= _type.size()) {
+		THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+			TOKEN_STORE_EXCEPTION_INVALID_ID,
+			"{" << id << "}"
+			);
+	}
+}
+
+tokid_t 
+_token_store::append(
+	token &tok
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	return append(tok, tok.get_origin());
+}
+
+tokid_t 
+_token_store::append(
+	token &tok,
+	const std::string &origin
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	byte_t flag = 0;
+	uint32_t origin_id;
+	size_t offset, length = tok.get_text_length();
+	tokid_t result = (tokid_t) _type.size();
+
+	if(length > MAX_TOKEN_STORE_TEXT_LENGTH) {
+		THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+			TOKEN_STORE_EXCEPTION_TEXT_TOO_LONG,
+			length
+			);
+	}
+
+	if(tok.get_type() == TOKEN_LABEL) {
+		offset = _symbol.intern(tok.get_text_data(), length);
+		flag |= TOKEN_STORE_FLAG_TEXT_SYMBOL;
+	} else if(tok.is_text_view()) {
+		offset = tok.get_text_data() - _source;
+		_text_viewed = true;
+	} else {
+		offset = _text_pool.size();
+		flag |= TOKEN_STORE_FLAG_TEXT_POOLED;
+	}
+
+	if(offset > MAX_TOKEN_STORE_TEXT_OFFSET) {
+		THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+			TOKEN_STORE_EXCEPTION_TEXT_OFFSET_TOO_LARGE,
+			offset
+			);
+	}
+
+	if(origin.empty()) {
+		flag |= TOKEN_STORE_FLAG_ORIGIN_NONE;
+	} else {
+		origin_id = _intern_origin(origin);
+
+		if(_origin_run.empty()
+				|| _origin_run.back() != origin_id) {
+			_origin_begin.push_back(result);
+			_origin_run.push_back(origin_id);
+		}
+	}
+
+	if(tok.get_value() > MAX_WORD) {
+		flag |= TOKEN_STORE_FLAG_VALUE_OVERFLOW;
+	}
+
+	if(flag & TOKEN_STORE_FLAG_TEXT_POOLED) {
+		_text_pool += tok.get_text();
+	}
+	tok.set_id(result);
+	_flag.push_back(flag);
+	_push_line(tok.get_line(), origin.empty() ? TOKEN_STORE_ORIGIN_NONE : origin_id);
+	_mode.push_back(TOKEN_STORE_FIELD(byte_t, tok.get_mode()));
+	_subtype.push_back(TOKEN_STORE_FIELD(byte_t, tok.get_subtype()));
+	_text_length.push_back((uint16_t) length);
+	_text_offset.push_back((uint32_t) offset);
+	_type.push_back(TOKEN_STORE_FIELD(byte_t, tok.get_type()));
+	_value.push_back((uint16_t) tok.get_value());
+
+	return result;
+}
+
+tokid_t 
+_token_store::append(
+	_token_store &other,
+	const std::vector<tokid_t> &order
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	tokid_t id;
+	byte_t flag;
+	uint32_t origin_id;
+	size_t offset, pool_offset = _text_pool.size();
+	tokid_t result = (tokid_t) _type.size();
+	std::vector<tokid_t>::const_iterator order_iter = order.begin();
+
+	if((pool_offset + other._text_pool.size()) > MAX_TOKEN_STORE_TEXT_OFFSET) {
+		THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+			TOKEN_STORE_EXCEPTION_TEXT_OFFSET_TOO_LARGE,
+			pool_offset + other._text_pool.size()
+			);
+	}
+	reserve(_type.size() + order.size());
+	_text_pool += other._text_pool;
+
+	for(; order_iter != order.end(); ++order_iter) {
+		id = *order_iter;
+		other._validate_id(id);
+		flag = other._flag[id];
+
+		if(flag & TOKEN_STORE_FLAG_TEXT_SYMBOL) {
+			offset = _symbol.intern(other._symbol.get_text_data(other._text_offset[id]), other._text_length[id]);
+		} else if(flag & TOKEN_STORE_FLAG_TEXT_POOLED) {
+			offset = pool_offset + other._text_offset[id];
+		} else if(other._source == _source) {
+			offset = other._text_offset[id];
+			_text_viewed = true;
+		} else {
+			offset = _text_pool.size();
+			_text_pool.append(other._source + other._text_offset[id], other._text_length[id]);
+			flag |= TOKEN_STORE_FLAG_TEXT_POOLED;
+		}
+
+		if(offset > MAX_TOKEN_STORE_TEXT_OFFSET) {
+			THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+				TOKEN_STORE_EXCEPTION_TEXT_OFFSET_TOO_LARGE,
+				offset
+				);
+		}
+
+		if(!(flag & TOKEN_STORE_FLAG_ORIGIN_NONE)) {
+			origin_id = _intern_origin(other._origin_table[other._find_origin(id)]);
+
+			if(_origin_run.empty()
+					|| _origin_run.back() != origin_id) {
+				_origin_begin.push_back((tokid_t) _type.size());
+				_origin_run.push_back(origin_id);
+			}
+		}
+		_flag.push_back(flag);
+		_push_line(other._line_value(id), (flag & TOKEN_STORE_FLAG_ORIGIN_NONE) ? TOKEN_STORE_ORIGIN_NONE : origin_id);
+		_mode.push_back(other._mode[id]);
+		_subtype.push_back(other._subtype[id]);
+		_text_length.push_back(other._text_length[id]);
+		_text_offset.push_back((uint32_t) offset);
+		_type.push_back(other._type[id]);
+		_value.push_back(other._value[id]);
+	}
+
+	return result;
+}
+
+void 
+_token_store::clear(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_flag.clear();
+	_line.clear();
+	_line_block.clear();
+	_mode.clear();
+	_origin_begin.clear();
+	_origin_run.clear();
+	_origin_table.clear();
+	_subtype.clear();
+	_symbol.clear();
+	_text_length.clear();
+	_text_offset.clear();
+	_text_pool.clear();
+	_text_viewed = false;
+	_type.clear();
+	_value.clear();
+}
+
+token 
+_token_store::get(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	token result(id, TOKEN_STORE_FIELD_VALUE(byte_t, _type[id]), TOKEN_STORE_FIELD_VALUE(byte_t, _subtype[id]), 
+		TOKEN_STORE_FIELD_VALUE(byte_t, _mode[id]), _line_value(id), 
+		(_flag[id] & TOKEN_STORE_FLAG_VALUE_OVERFLOW) ? (size_t) MAX_WORD + 1 : _value[id]);
+
+	if(!(_flag[id] & TOKEN_STORE_FLAG_ORIGIN_NONE)) {
+		result.set_origin(_origin_table.at(_find_origin(id)));
+	}
+
+	if(_flag[id] & TOKEN_STORE_FLAG_TEXT_SYMBOL) {
+		result.set_text(_symbol.get_text(_text_offset[id]));
+	} else if(_flag[id] & TOKEN_STORE_FLAG_TEXT_POOLED) {
+
+		if(_text_length[id]) {
+			result.set_text(_text_pool.substr(_text_offset[id], _text_length[id]));
+		}
+	} else {
+		result.set_text_view(_source + _text_offset[id], _text_length[id]);
+	}
+
+	return result;
+}
+
+size_t 
+_token_store::get_line(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	return _line_value(id);
+}
+
+size_t 
+_token_store::get_mode(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	return TOKEN_STORE_FIELD_VALUE(byte_t, _mode[id]);
+}
+
+std::string 
+_token_store::get_origin(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	if(_flag[id] & TOKEN_STORE_FLAG_ORIGIN_NONE) {
+		return std::string();
+	}
+
+	return _origin_table.at(_find_origin(id));
+}
+
+size_t 
+_token_store::get_subtype(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	return TOKEN_STORE_FIELD_VALUE(byte_t, _subtype[id]);
+}
+
+symid_t 
+_token_store::get_symbol(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	if(!(_flag[id] & TOKEN_STORE_FLAG_TEXT_SYMBOL)) {
+		return INVALID_SYMBOL_ID;
+	}
+
+	return _text_offset[id];
+}
+
+std::string 
+_token_store::get_text(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	if(_flag[id] & TOKEN_STORE_FLAG_TEXT_SYMBOL) {
+		return _symbol.get_text(_text_offset[id]);
+	}
+
+	return std::string(((_flag[id] & TOKEN_STORE_FLAG_TEXT_POOLED) ? _text_pool.c_str() : _source) + _text_offset[id], 
+		_text_length[id]);
+}
+
+const char * 
+_token_store::get_text_data(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	if(_flag[id] & TOKEN_STORE_FLAG_TEXT_SYMBOL) {
+		return _symbol.get_text_data(_text_offset[id]);
+	}
+
+	return ((_flag[id] & TOKEN_STORE_FLAG_TEXT_POOLED) ? _text_pool.c_str() : _source) + _text_offset[id];
+}
+
+size_t 
+_token_store::get_text_length(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	return _text_length[id];
+}
+
+size_t 
+_token_store::get_type(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	return TOKEN_STORE_FIELD_VALUE(byte_t, _type[id]);
+}
+
+size_t 
+_token_store::get_value(
+	tokid_t id
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+
+	if(_flag[id] & TOKEN_STORE_FLAG_VALUE_OVERFLOW) {
+		return (size_t) MAX_WORD + 1;
+	}
+
+	return _value[id];
+}
+
+void 
+_token_store::pool_text(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	size_t offset;
+	tokid_t id = 0;
+
+	if(!_text_viewed) {
+		return;
+	}
+
+	for(; id < _flag.size(); ++id) {
+
+		if(_flag[id] & (TOKEN_STORE_FLAG_TEXT_POOLED | TOKEN_STORE_FLAG_TEXT_SYMBOL)) {
+			continue;
+		}
+
+		offset = _text_pool.size();
+
+		if(offset > MAX_TOKEN_STORE_TEXT_OFFSET) {
+			THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(
+				TOKEN_STORE_EXCEPTION_TEXT_OFFSET_TOO_LARGE,
+				offset
+				);
+		}
+		_text_pool.append(_source + _text_offset[id], _text_length[id]);
+		_text_offset[id] = (uint32_t) offset;
+		_flag[id] |= TOKEN_STORE_FLAG_TEXT_POOLED;
+	}
+	_text_viewed = false;
+}
+
+void 
+_token_store::reserve(
+	size_t count
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_flag.reserve(count);
+	_line.reserve(count);
+	_line_block.reserve((count / TOKEN_STORE_LINE_BLOCK_LENGTH) + 1);
+	_mode.reserve(count);
+	_subtype.reserve(count);
+	_text_length.reserve(count);
+	_text_offset.reserve(count);
+	_type.reserve(count);
+	_value.reserve(count);
+}
+
+void 
+_token_store::set_mode(
+	tokid_t id,
+	size_t mode
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_validate_id(id);
+	_mode[id] = TOKEN_STORE_FIELD(byte_t, mode);
+}
+
+void 
+_token_store::set_source(
+	const char *data
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	_source = data;
+}
+
+void 
+_token_store::shift_lines(
+	const std::string &origin,
+	size_t line,
+	long delta
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	size_t block = 0;
+	token_store_block_ptr current;
+	uint32_t origin_id = TOKEN_STORE_ORIGIN_NONE;
+
+	if(!origin.empty()) {
+
+		for(origin_id = 0; origin_id < _origin_table.size(); ++origin_id) {
+
+			if(_origin_table.at(origin_id) == origin) {
+				break;
+			}
+		}
+
+		if(origin_id == _origin_table.size()) {
+			return;
+		}
+	}
+
+	for(; block < _line_block.size(); ++block) {
+		current = &_line_block[block];
+
+		if((current->line_min > current->line_max)
+				|| ((current->origin != TOKEN_STORE_ORIGIN_MIXED) && (current->origin != origin_id))
+				|| (((long) current->line_max + current->shift) < (long) line)) {
+			continue;
+		}
+
+		if((current->origin != TOKEN_STORE_ORIGIN_MIXED)
+				&& (((long) current->line_min + current->shift) >= (long) line)
+				&& (((block + 1) * TOKEN_STORE_LINE_BLOCK_LENGTH) <= _line.size())) {
+			current->shift += delta;
+		} else {
+			_shift_block(block, origin_id, line, delta);
+		}
+	}
+}
+
+size_t 
+_token_store::size(void)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	return _type.size();
+}
+
+std::string 
+_token_store::to_string(
+	bool verbose
+	)
+{
+	LOCK_OBJECT(object_lock_t, _token_store_lock);
+
+	std::stringstream ss;
+
+	ss << "(" << _type.size() << " tokens";
+
+	if(verbose) {
+		ss << ", " << _origin_table.size() << " origins, " << _origin_run.size() << " origin runs, " << _symbol.size() << " symbols, " << _text_pool.size() << " pooled bytes";
+	}
+	ss << ")";
+
+	return ss.str();
+}
\ No newline at end of file
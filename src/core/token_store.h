@@ -0,0 +1,206 @@
+/*
+ * token_store.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKEN_STORE_H_
+#define TOKEN_STORE_H_
+
+#include <vector>
+#include "symbol_table.h"
+#include "token.h"
+#include "type.h"
+
+typedef struct _token_store_block_t {
+	uint32_t line_max;
+	uint32_t line_min;
+	uint32_t origin;
+	long shift;
+} token_store_block_t, *token_store_block_ptr;
+
+typedef class _token_store {
+
+	public:
+
+		_token_store(void);
+
+		_token_store(
+			const _token_store &other
+			);
+
+		virtual ~_token_store(void);
+
+		_token_store &operator=(
+			const _token_store &other
+			);
+
+		tokid_t append(
+			token &tok
+			);
+
+		tokid_t append(
+			token &tok,
+			const std::string &origin
+			);
+
+		tokid_t append(
+			_token_store &other,
+			const std::vector<tokid_t> &order
+			);
+
+		virtual void clear(void);
+
+		token get(
+			tokid_t id
+			);
+
+		size_t get_line(
+			tokid_t id
+			);
+
+		size_t get_mode(
+			tokid_t id
+			);
+
+		std::string get_origin(
+			tokid_t id
+			);
+
+		size_t get_subtype(
+			tokid_t id
+			);
+
+		symid_t get_symbol(
+			tokid_t id
+			);
+
+		std::string get_text(
+			tokid_t id
+			);
+
+		const char *get_text_data(
+			tokid_t id
+			);
+
+		size_t get_text_length(
+			tokid_t id
+			);
+
+		size_t get_type(
+			tokid_t id
+			);
+
+		size_t get_value(
+			tokid_t id
+			);
+
+		void pool_text(void);
+
+		void reserve(
+			size_t count
+			);
+
+		void set_mode(
+			tokid_t id,
+			size_t mode
+			);
+
+		void set_source(
+			const char *data
+			);
+
+		void shift_lines(
+			const std::string &origin,
+			size_t line,
+			long delta
+			);
+
+		virtual size_t size(void);
+
+		virtual std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		uint32_t _find_origin(
+			tokid_t id
+			);
+
+		uint32_t _intern_origin(
+			const std::string &origin
+			);
+
+		size_t _line_value(
+			tokid_t id
+			);
+
+		void _push_line(
+			size_t line,
+			uint32_t origin
+			);
+
+		void _shift_block(
+			size_t block,
+			uint32_t origin,
+			size_t line,
+			long delta
+			);
+
+		void _validate_id(
+			tokid_t id
+			);
+
+		std::vector<byte_t> _flag;
+
+		std::vector<uint32_t> _line;
+
+		std::vector<token_store_block_t> _line_block;
+
+		std::vector<byte_t> _mode;
+
+		std::vector<tokid_t> _origin_begin;
+
+		std::vector<uint32_t> _origin_run;
+
+		std::vector<std::string> _origin_table;
+
+		const char *_source;
+
+		std::vector<byte_t> _subtype;
+
+		symbol_table _symbol;
+
+		std::vector<uint16_t> _text_length;
+
+		std::vector<uint32_t> _text_offset;
+
+		std::string _text_pool;
+
+		bool _text_viewed;
+
+		std::vector<byte_t> _type;
+
+		std::vector<uint16_t> _value;
+
+	private:
+
+		object_lock_t _token_store_lock;
+
+} token_store, *token_store_ptr;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*
+ * token_store_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKEN_STORE_TYPE_H_
+#define TOKEN_STORE_TYPE_H_
+
+#include "type.h"
+
+enum {
+	TOKEN_STORE_EXCEPTION_INVALID_ID = 0,
+	TOKEN_STORE_EXCEPTION_TEXT_OFFSET_TOO_LARGE,
+	TOKEN_STORE_EXCEPTION_TEXT_TOO_LONG,
+};
+
+static const std::string TOKEN_STORE_EXCEPTION_STR[] = {
+	"Invalid token id",
+	"Token text offset too large",
+	"Token text too long",
+};
+
+#define MAX_TOKEN_STORE_EXCEPTION TOKEN_STORE_EXCEPTION_TEXT_TOO_LONG
+enum {
+	TOKEN_STORE_FLAG_ORIGIN_NONE = 0x1,
+	TOKEN_STORE_FLAG_TEXT_POOLED = 0x2,
+	TOKEN_STORE_FLAG_TEXT_SYMBOL = 0x4,
+	TOKEN_STORE_FLAG_VALUE_OVERFLOW = 0x8,
+};
+
+#define MAX_TOKEN_STORE_TEXT_LENGTH UINT16_MAX
+#define MAX_TOKEN_STORE_TEXT_OFFSET UINT32_MAX
+#define SHOW_TOKEN_STORE_EXCEPTION_HEADER true
+#define TOKEN_STORE_EXCEPTION_HEADER "TOKEN STORE"
+
+#define TOKEN_STORE_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_TOKEN_STORE_EXCEPTION ? UNKNOWN_EXCEPTION : TOKEN_STORE_EXCEPTION_STR[_T_])
+#define TOKEN_STORE_LINE_BLOCK_LENGTH (0x400)
+#define TOKEN_STORE_ORIGIN_MIXED ((uint32_t) -1)
+#define TOKEN_STORE_ORIGIN_NONE ((uint32_t) -2)
+#define TOKEN_STORE_FIELD(_T_, _V_) ((_V_) == INVALID_TYPE ? ((_T_) -1) : ((_T_) (_V_)))
+#define TOKEN_STORE_FIELD_VALUE(_T_, _V_) ((_V_) == ((_T_) -1) ? INVALID_TYPE : ((size_t) (_V_)))
+#define THROW_TOKEN_STORE_EXCEPTION(_T_)\
+	THROW_EXCEPTION(TOKEN_STORE_EXCEPTION_HEADER, TOKEN_STORE_EXCEPTION_STRING(_T_), SHOW_TOKEN_STORE_EXCEPTION_HEADER)
+#define THROW_TOKEN_STORE_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(TOKEN_STORE_EXCEPTION_HEADER, TOKEN_STORE_EXCEPTION_STRING(_T_), _M_, SHOW_TOKEN_STORE_EXCEPTION_HEADER)
+
+class _token_store;
+typedef _token_store token_store, *token_store_ptr;
+
+#endif
\ No newline at end of file
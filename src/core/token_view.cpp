@@ -0,0 +1,187 @@
+/*
+ * token_view.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "token_view.h"
+#include "token_view_type.h"
+
+_token_view::_token_view(void) :
+	_id(INVALID_TOKEN_ID),
+	_store(NULL)
+{
+	return;
+}
+
+_token_view::_token_view(
+	token_store_ptr store,
+	tokid_t id
+	) :
+		_id(id),
+		_store(store)
+{
+	return;
+}
+
+_token_view::_token_view(
+	const _token_view &other
+	) :
+		_id(other._id),
+		_store(other._store)
+{
+	return;
+}
+
+_token_view::~_token_view(void)
+{
+	return;
+}
+
+_token_view &
+_token_view::operator=(
+	const _token_view &other
+	)
+{
+
+	if(this != &other) {
+		_id = other._id;
+		_store = other._store;
+	}
+
+	return *this;
+}
+
+void 
+_token_view::_validate(void)
+{
+
+	if(!_store) {
+		THROW_TOKEN_VIEW_EXCEPTION_WITH_MESSAGE(
+			TOKEN_VIEW_EXCEPTION_UNBOUND,
+			"{" << _id << "}"
+			);
+	}
+}
+
+token 
+_token_view::get(void)
+{
+	_validate();
+
+	return _store->get(_id);
+}
+
+tokid_t 
+_token_view::get_id(void)
+{
+	return _id;
+}
+
+size_t 
+_token_view::get_line(void)
+{
+	_validate();
+
+	return _store->get_line(_id);
+}
+
+size_t 
+_token_view::get_mode(void)
+{
+	_validate();
+
+	return _store->get_mode(_id);
+}
+
+std::string 
+_token_view::get_origin(void)
+{
+	_validate();
+
+	return _store->get_origin(_id);
+}
+
+size_t 
+_token_view::get_subtype(void)
+{
+	_validate();
+
+	return _store->get_subtype(_id);
+}
+
+symid_t 
+_token_view::get_symbol(void)
+{
+	_validate();
+
+	return _store->get_symbol(_id);
+}
+
+std::string 
+_token_view::get_text(void)
+{
+	_validate();
+
+	return _store->get_text(_id);
+}
+
+const char * 
+_token_view::get_text_data(void)
+{
+	_validate();
+
+	return _store->get_text_data(_id);
+}
+
+size_t 
+_token_view::get_text_length(void)
+{
+	_validate();
+
+	return _store->get_text_length(_id);
+}
+
+size_t 
+_token_view::get_type(void)
+{
+	_validate();
+
+	return _store->get_type(_id);
+}
+
+size_t 
+_token_view::get_value(void)
+{
+	_validate();
+
+	return _store->get_value(_id);
+}
+
+bool 
+_token_view::is_valid(void)
+{
+	return _store 
+			&& (_id < _store->size());
+}
+
+std::string 
+_token_view::to_string(
+	bool verbose
+	)
+{
+	return get().to_string(verbose);
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+/*
+ * token_view.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKEN_VIEW_H_
+#define TOKEN_VIEW_H_
+
+#include "token_store.h"
+#include "type.h"
+
+typedef class _token_view {
+
+	public:
+
+		_token_view(void);
+
+		_token_view(
+			token_store_ptr store,
+			tokid_t id
+			);
+
+		_token_view(
+			const _token_view &other
+			);
+
+		virtual ~_token_view(void);
+
+		_token_view &operator=(
+			const _token_view &other
+			);
+
+		token get(void);
+
+		tokid_t get_id(void);
+
+		size_t get_line(void);
+
+		size_t get_mode(void);
+
+		std::string get_origin(void);
+
+		size_t get_subtype(void);
+
+		symid_t get_symbol(void);
+
+		std::string get_text(void);
+
+		const char *get_text_data(void);
+
+		size_t get_text_length(void);
+
+		size_t get_type(void);
+
+		size_t get_value(void);
+
+		bool is_valid(void);
+
+		virtual std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		void _validate(void);
+
+		tokid_t _id;
+
+		token_store_ptr _store;
+
+} token_view, *token_view_ptr;
+
+#endif
\ No newline at end of file
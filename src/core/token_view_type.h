@@ -0,0 +1,47 @@
+/*
+ * token_view_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKEN_VIEW_TYPE_H_
+#define TOKEN_VIEW_TYPE_H_
+
+#include "type.h"
+
+enum {
+	TOKEN_VIEW_EXCEPTION_UNBOUND = 0,
+};
+
+static const std::string TOKEN_VIEW_EXCEPTION_STR[] = {
+	"Token view is unbound",
+};
+
+#define MAX_TOKEN_VIEW_EXCEPTION TOKEN_VIEW_EXCEPTION_UNBOUND
+#define SHOW_TOKEN_VIEW_EXCEPTION_HEADER true
+#define TOKEN_VIEW_EXCEPTION_HEADER "TOKEN VIEW"
+
+#define TOKEN_VIEW_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_TOKEN_VIEW_EXCEPTION ? UNKNOWN_EXCEPTION : TOKEN_VIEW_EXCEPTION_STR[_T_])
+#define THROW_TOKEN_VIEW_EXCEPTION(_T_)\
+	THROW_EXCEPTION(TOKEN_VIEW_EXCEPTION_HEADER, TOKEN_VIEW_EXCEPTION_STRING(_T_), SHOW_TOKEN_VIEW_EXCEPTION_HEADER)
+#define THROW_TOKEN_VIEW_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(TOKEN_VIEW_EXCEPTION_HEADER, TOKEN_VIEW_EXCEPTION_STRING(_T_), _M_, SHOW_TOKEN_VIEW_EXCEPTION_HEADER)
+
+class _token_view;
+typedef _token_view token_view, *token_view_ptr;
+
+#endif
\ No newline at end of file
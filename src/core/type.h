@@ -28,10 +28,37 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifndef SYNCHRONIZE_OBJECT
+#define SYNCHRONIZE_OBJECT 1
+#endif
+
+#ifndef PARALLEL_OBJECT
+#define PARALLEL_OBJECT SYNCHRONIZE_OBJECT
+#endif
+
+#if PARALLEL_OBJECT && !SYNCHRONIZE_OBJECT
+#error "PARALLEL_OBJECT requires SYNCHRONIZE_OBJECT"
+#endif
 
 #define BYTE_WIDTH (8)
 #define INVALID "INVALID"
 #define INVALID_BYTE ((uint8_t) -1)
+#define INVALID_NODE_ID ((nodeid_t) -1)
+#define INVALID_POSITION ((size_t) -1)
+#define INVALID_STATEMENT_ID ((stmtid_t) -1)
+#define INVALID_SYMBOL_ID ((symid_t) -1)
+#define INVALID_TOKEN_ID ((tokid_t) -1)
 #define INVALID_TYPE ((size_t) -1)
 #define INVALID_WORD ((uint16_t) -1)
 #define INVALID_VALUE (-1)
@@ -40,7 +67,6 @@
 #define UNKNOWN_EXCEPTION "Unknown exception"
 
 #define __TO_STRING_X(_T_) #_T_
-#define LOCK_OBJECT(_T_, _M_) std::lock_guard<_T_> __LOCK_##_M_(_M_)
 #define REFERENCE_PARAMETER(_P_) ((void) _P_)
 #define THROW_EXCEPTION(_H_, _V_, _VB_) {\
 	std::stringstream __ss;\
@@ -61,7 +87,43 @@
 #define VALUE_AS_HEX(_T_, _V_)\
 	std::setw(sizeof(_T_) * 2) << std::setfill('0') << std::hex << ((unsigned) _V_) << std::dec
 
+#if SYNCHRONIZE_OBJECT
+#define LOCK_OBJECT(_T_, _M_) std::lock_guard<_T_> __LOCK_##_M_(_M_)
+
+typedef std::recursive_mutex object_lock_t;
+#else
+#define LOCK_OBJECT(_T_, _M_) REFERENCE_PARAMETER(_M_)
+
+typedef struct _object_lock_t {} object_lock_t;
+#endif
+
+#if PARALLEL_OBJECT
+#define THREAD_COUNT() ((size_t) std::thread::hardware_concurrency())
+#else
+#define THREAD_COUNT() ((size_t) 1)
+#endif
+
 typedef uint8_t byte_t, *byte_ptr;
+typedef uint32_t nodeid_t, *nodeid_ptr;
+typedef uint32_t stmtid_t, *stmtid_ptr;
+typedef uint32_t symid_t, *symid_ptr;
+typedef uint32_t tokid_t, *tokid_ptr;
 typedef uint16_t word_t, *word_ptr;
 
+static inline uint32_t 
+__trailing_zero_count(
+	uint32_t value
+	)
+{
+#ifdef _MSC_VER
+	unsigned long result = 0;
+
+	_BitScanForward(&result, value);
+
+	return (uint32_t) result;
+#else
+	return (uint32_t) __builtin_ctz(value);
+#endif
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,400 @@
+/*
+ * benchmark.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+#include <chrono>
+#include <thread>
+#include "benchmark.h"
+#include "assembler.h"
+#include "uuid.h"
+#include "uuid_generator.h"
+#include "benchmark_type.h"
+
+namespace benchmark {
+
+static std::string 
+generate_labels(
+	size_t label_count
+	)
+{
+	std::stringstream ss;
+	size_t iter = 0, reference = 1;
+
+	for(; iter < label_count; ++iter) {
+		reference = ((reference * BENCHMARK_LABEL_MULTIPLIER) + 1) % label_count;
+		ss << ":label_" << iter << " set a, label_" << reference << std::endl;
+	}
+
+	return ss.str();
+}
+
+static std::string 
+generate_program(
+	size_t line_count
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < line_count; ++iter) {
+
+		switch(iter % 4) {
+			case 0:
+				ss << ":label_" << iter << " set a, [b+0x" << std::hex << (iter & 0xffff) << std::dec << "]" << std::endl;
+				break;
+			case 1:
+				ss << "\tadd x, label_" << (iter - 1) << "\t; running total" << std::endl;
+				break;
+			case 2:
+				ss << "\tifn [0x8000+i], 0x1f" << std::endl;
+				break;
+			default:
+				ss << "\tdat \"text\", " << iter << ", 0" << std::endl;
+				break;
+		}
+	}
+
+	return ss.str();
+}
+
+static std::string 
+generate_statements(
+	size_t statement_count
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < statement_count; ++iter) {
+
+		switch(iter % 4) {
+			case 0:
+				ss << ":label_" << iter << " set a, [b+0x" << std::hex << (iter & 0xffff) << std::dec << "] ";
+				break;
+			case 1:
+				ss << "add x, label_" << (iter - 1) << " ";
+				break;
+			case 2:
+				ss << "ifn [0x8000+i], 0x1f ";
+				break;
+			default:
+				ss << "dat \"text\", " << (iter & 0xffff) << ", 0 ";
+				break;
+		}
+	}
+
+	return ss.str();
+}
+
+static void 
+generate_uuids(
+	uuid_generator &generator,
+	std::vector<uuidl_t> &output
+	)
+{
+	generator.generate_long_ids(BENCHMARK_UUID_GENERATE_COUNT / BENCHMARK_UUID_THREAD_COUNT, output, false);
+}
+
+static std::string 
+generate_whitespace(
+	size_t line_count
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < line_count; ++iter) {
+
+		switch(iter % 3) {
+			case 0:
+				ss << "\t\t\t\t\t\t; " << std::string(48, '-') << std::endl;
+				break;
+			case 1:
+				ss << "; " << std::string(64, '=') << std::endl;
+				break;
+			default:
+				ss << std::string(24, ' ') << "\t\t" << std::endl << std::endl;
+				break;
+		}
+	}
+
+	return ss.str();
+}
+
+static double 
+elapsed_nanoseconds(
+	const std::chrono::high_resolution_clock::time_point &begin
+	)
+{
+	return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::high_resolution_clock::now() - begin).count();
+}
+
+static size_t 
+peak_memory(void)
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+
+	return (size_t) counters.PeakWorkingSetSize;
+#else
+	struct rusage usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	return (size_t) usage.ru_maxrss * 1024;
+#endif
+}
+
+static void 
+benchmark_labels(void)
+{
+	double elapsed;
+	std::chrono::high_resolution_clock::time_point begin;
+	std::string input = generate_labels(BENCHMARK_LABEL_COUNT);
+
+	begin = std::chrono::high_resolution_clock::now();
+	assembler assemb(input, false);
+	assemb.generate(std::string(), false);
+	elapsed = elapsed_nanoseconds(begin);
+	std::cout << (elapsed / 1000000000.0) << " sec. (" << (elapsed / BENCHMARK_LABEL_COUNT) << " ns/label, " 
+		<< assemb.get_binary_data().size() << " words)";
+}
+
+static void 
+benchmark_lexer(void)
+{
+	size_t iter = 0;
+	double best = 0.0, elapsed;
+	std::chrono::high_resolution_clock::time_point begin;
+	std::string input = generate_program(BENCHMARK_LINE_COUNT);
+
+	for(; iter < BENCHMARK_REPEAT_COUNT; ++iter) {
+		lexer lex(input, false);
+
+		begin = std::chrono::high_resolution_clock::now();
+		lex.discover();
+		elapsed = elapsed_nanoseconds(begin) / lex.size();
+
+		if(!iter
+				|| (elapsed < best)) {
+			best = elapsed;
+		}
+	}
+	std::cout << best << " ns/token";
+}
+
+static void 
+benchmark_serial_scaling(void)
+{
+	size_t iter = 0, statement_count;
+	double elapsed;
+	std::string input;
+	std::chrono::high_resolution_clock::time_point begin;
+
+	for(; iter < BENCHMARK_SCALING_STEP_COUNT; ++iter) {
+		statement_count = BENCHMARK_LINE_COUNT << iter;
+		input = generate_statements(statement_count);
+		begin = std::chrono::high_resolution_clock::now();
+		assembler assemb(input, false);
+		assemb.generate(std::string(), false);
+		elapsed = elapsed_nanoseconds(begin);
+		std::cout << (iter ? ", " : "") << statement_count << " stmt. " << (elapsed / statement_count) << " ns/stmt";
+	}
+}
+
+static void 
+benchmark_token_access(void)
+{
+	size_t iter = 0, sum = 0;
+	token_view view;
+	double best = 0.0, elapsed;
+	std::chrono::high_resolution_clock::time_point begin;
+	lexer lex(generate_program(BENCHMARK_LINE_COUNT), false);
+
+	lex.discover();
+
+	for(; iter < BENCHMARK_REPEAT_COUNT; ++iter) {
+		lex.reset();
+		begin = std::chrono::high_resolution_clock::now();
+
+		while(lex.has_next_token()) {
+			view = lex.move_next_token();
+			sum += view.get_type() + view.get_subtype() + view.get_line() + lex.get_token_type(view.get_id());
+		}
+		elapsed = elapsed_nanoseconds(begin) / lex.size();
+
+		if(!iter
+				|| (elapsed < best)) {
+			best = elapsed;
+		}
+	}
+	std::cout << best << " ns/token (" << sum << ")";
+}
+
+static void 
+benchmark_token_memory(void)
+{
+	size_t begin;
+	std::string input = generate_program(BENCHMARK_LINE_COUNT * 5);
+	lexer lex(input, false);
+
+	begin = peak_memory();
+	lex.discover();
+	std::cout << ((peak_memory() - begin) / (double) lex.size()) << " bytes/token (" << lex.size() << " tokens)";
+}
+
+static void 
+benchmark_uuid(void)
+{
+	size_t iter = 0, unique = 0;
+	double lookup, registration;
+	std::vector<uuidl_t> id;
+	std::chrono::high_resolution_clock::time_point begin;
+
+	id.reserve(BENCHMARK_UUID_COUNT);
+
+	for(; iter < BENCHMARK_UUID_COUNT; ++iter) {
+		id.push_back(uuid::generate_long_id(false));
+	}
+	begin = std::chrono::high_resolution_clock::now();
+
+	for(iter = 0; iter < BENCHMARK_UUID_COUNT; ++iter) {
+		uuid::register_long_id(id.at(iter));
+	}
+	registration = elapsed_nanoseconds(begin);
+	begin = std::chrono::high_resolution_clock::now();
+
+	for(iter = 0; iter < BENCHMARK_UUID_COUNT; ++iter) {
+		unique += uuid::is_unique_long_id(id.at(iter)) ? 1 : 0;
+	}
+	lookup = elapsed_nanoseconds(begin);
+
+	for(iter = 0; iter < BENCHMARK_UUID_COUNT; ++iter) {
+		uuid::unregister_long_id(id.at(iter));
+	}
+	std::cout << "register " << (registration / 1000000000.0) << " sec., lookup " << (lookup / 1000000000.0) 
+		<< " sec. (" << BENCHMARK_UUID_COUNT << " ids, " << unique << " unique)";
+}
+
+static void 
+benchmark_uuid_generate(void)
+{
+	size_t iter = 0;
+	double batch, single, threaded;
+	std::vector<std::thread> worker_thread;
+	std::chrono::high_resolution_clock::time_point begin;
+	std::vector<uuidl_t> id, output[BENCHMARK_UUID_THREAD_COUNT];
+	uuid_generator generator[BENCHMARK_UUID_THREAD_COUNT];
+
+	id.reserve(BENCHMARK_UUID_GENERATE_COUNT);
+	begin = std::chrono::high_resolution_clock::now();
+
+	for(; iter < BENCHMARK_UUID_GENERATE_COUNT; ++iter) {
+		id.push_back(uuid::generate_long_id(false));
+	}
+	single = elapsed_nanoseconds(begin);
+	id.clear();
+	begin = std::chrono::high_resolution_clock::now();
+	uuid::generate_long_ids(BENCHMARK_UUID_GENERATE_COUNT, id, false);
+	batch = elapsed_nanoseconds(begin);
+
+	for(iter = 0; iter < BENCHMARK_UUID_THREAD_COUNT; ++iter) {
+		uuid::initialize_generator(generator[iter]);
+		output[iter].reserve(BENCHMARK_UUID_GENERATE_COUNT / BENCHMARK_UUID_THREAD_COUNT);
+	}
+	begin = std::chrono::high_resolution_clock::now();
+
+	for(iter = 0; iter < BENCHMARK_UUID_THREAD_COUNT; ++iter) {
+		worker_thread.push_back(std::thread(generate_uuids, std::ref(generator[iter]), std::ref(output[iter])));
+	}
+
+	for(iter = 0; iter < worker_thread.size(); ++iter) {
+		worker_thread.at(iter).join();
+	}
+	threaded = elapsed_nanoseconds(begin);
+	std::cout << "single " << ((BENCHMARK_UUID_GENERATE_COUNT * 1000.0) / single) << " M/s, batch " 
+		<< ((BENCHMARK_UUID_GENERATE_COUNT * 1000.0) / batch) << " M/s, " << BENCHMARK_UUID_THREAD_COUNT 
+		<< " threads " << ((BENCHMARK_UUID_GENERATE_COUNT * 1000.0) / threaded) << " M/s";
+}
+
+static void 
+benchmark_whitespace(void)
+{
+	size_t iter = 0;
+	double best = 0.0, elapsed;
+	std::chrono::high_resolution_clock::time_point begin;
+	std::string input = generate_whitespace(BENCHMARK_LINE_COUNT);
+
+	for(; iter < BENCHMARK_REPEAT_COUNT; ++iter) {
+		lexer lex(input, false);
+
+		begin = std::chrono::high_resolution_clock::now();
+		lex.discover();
+		elapsed = (input.size() * 1000.0) / elapsed_nanoseconds(begin);
+
+		if(!iter
+				|| (elapsed > best)) {
+			best = elapsed;
+		}
+	}
+	std::cout << best << " MB/s";
+}
+
+static const benchmark_t BENCHMARK[] = {
+	{ benchmark_labels, "labels", },
+	{ benchmark_lexer, "lexer", },
+	{ benchmark_serial_scaling, "serial_scaling", },
+	{ benchmark_token_access, "token_access", },
+	{ benchmark_token_memory, "token_memory", },
+	{ benchmark_uuid, "uuid", },
+	{ benchmark_uuid_generate, "uuid_generate", },
+	{ benchmark_whitespace, "whitespace", },
+	};
+
+#define BENCHMARK_COUNT (sizeof(BENCHMARK) / sizeof(benchmark_t))
+
+void 
+run(
+	const std::string &name
+	)
+{
+	size_t iter = 0;
+
+	for(; iter < BENCHMARK_COUNT; ++iter) {
+
+		if(!name.empty()
+				&& (name != BENCHMARK[iter].name)) {
+			continue;
+		}
+		std::cout << BENCHMARK[iter].name << "... ";
+		BENCHMARK[iter].function();
+		std::cout << std::endl;
+	}
+}
+}
\ No newline at end of file
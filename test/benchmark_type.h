@@ -0,0 +1,41 @@
+/*
+ * benchmark_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARK_TYPE_H_
+#define BENCHMARK_TYPE_H_
+
+#include "type.h"
+
+#define BENCHMARK_LABEL_COUNT (1000000)
+#define BENCHMARK_LABEL_MULTIPLIER (48271)
+#define BENCHMARK_LINE_COUNT (200000)
+#define BENCHMARK_REPEAT_COUNT (3)
+#define BENCHMARK_SCALING_STEP_COUNT (3)
+#define BENCHMARK_UUID_COUNT (10000000)
+#define BENCHMARK_UUID_GENERATE_COUNT (2000000)
+#define BENCHMARK_UUID_THREAD_COUNT (4)
+
+typedef void (*benchmark_function_t)(void);
+
+typedef struct _benchmark_t {
+	benchmark_function_t function;
+	const char *name;
+} benchmark_t, *benchmark_ptr;
+
+#endif
\ No newline at end of file
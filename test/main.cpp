@@ -0,0 +1,116 @@
+/*
+ * main.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include "benchmark.h"
+#include "dasm16.h"
+#include "test.h"
+
+enum {
+	NO_ERROR = 0,
+	TEST_ERROR,
+	INP_ERROR,
+	DISP_HELP,
+};
+
+#define APP_TITLE "DASM16 TEST"
+#define BENCHMARK_FLAG 'b'
+#define HELP_FLAG 'h'
+#define VERBOSE_FLAG 'v'
+#define USAGE_STRING "Usage: test [-h | -v] [-b [NAME]]"
+
+int
+main(
+	int argc,
+	char **argv
+	)
+{
+	size_t failed;
+	int i = 1, result = NO_ERROR;
+	std::string benchmark_name, flag;
+	bool benchmark_mode = false, verbose_mode = false;
+
+	for(; i < argc; ++i) {
+		flag = argv[i];
+
+		if((flag.size() != 2)
+				|| ((flag.at(0) != '-')
+				&& (flag.at(0) != '/'))) {
+			std::cerr << "Unknown flag: \'" << flag << "\'" << std::endl;
+			result = INP_ERROR;
+			break;
+		}
+
+		switch(flag.at(1)) {
+			case BENCHMARK_FLAG:
+				benchmark_mode = true;
+
+				if((i < (argc - 1))
+						&& (*argv[i + 1] != '-')
+						&& (*argv[i + 1] != '/')) {
+					benchmark_name = argv[++i];
+				}
+				break;
+			case HELP_FLAG:
+				std::cout << APP_TITLE << " " << dasm16::version(true) << std::endl
+					<< USAGE_STRING << std::endl << std::endl
+					<< "-" << BENCHMARK_FLAG << ": Run benchmarks (all, or NAME only)" << std::endl
+					<< "-" << HELP_FLAG << ": Display help message" << std::endl
+					<< "-" << VERBOSE_FLAG << ": Set verbose mode" << std::endl;
+				result = DISP_HELP;
+				break;
+			case VERBOSE_FLAG:
+				verbose_mode = true;
+				break;
+			default:
+				std::cerr << "Unknown flag: \'" << flag << "\'" << std::endl;
+				result = INP_ERROR;
+				break;
+		}
+
+		if(result) {
+			break;
+		}
+	}
+
+	if(!result) {
+		dasm16::initialize();
+
+		try {
+
+			if(benchmark_mode) {
+				benchmark::run(benchmark_name);
+			} else {
+				failed = test::run(verbose_mode);
+
+				if(failed) {
+					std::cerr << failed << " test(s) FAILED!" << std::endl;
+					result = TEST_ERROR;
+				} else if(verbose_mode) {
+					std::cout << "All tests passed." << std::endl;
+				}
+			}
+		} catch(std::runtime_error &exc) {
+			std::cerr << "EXCEPTION: " << exc.what() << std::endl;
+			result = TEST_ERROR;
+		}
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,848 @@
+/*
+ * test.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include "assembler.h"
+#include "lang_def.h"
+#include "lexer_base_type.h"
+#include "parser_type.h"
+#include "test.h"
+#include "test_type.h"
+#include "uuid_generator.h"
+#include "uuid_hash_set.h"
+#include "uuid_hash_set_type.h"
+
+namespace test {
+
+static const std::string SAMPLE_PROGRAM =
+	"\tset a, 0xbeef\n"
+	"\tset [0x1000], a\n"
+	"\tifn a, [0x1000]\n"
+	"\tset PC, end\n"
+	"\tset i, 0\n"
+	":nextchar ife [data+i], 0\n"
+	"\tset PC, end\n"
+	"\tset [0x8000+i], [data+i]\n"
+	"\tadd i, 1\n"
+	"\tset PC, nextchar\n"
+	":data dat \"Hello world!\", 0\n"
+	":end sub PC, 1\n";
+
+static const word_t SAMPLE_BINARY[] = {
+	0x7c01, 0xbeef, 0x03c1, 0x1000, 0x7813, 0x1000, 0x7f81, 0x0020,
+	0x84c1, 0x86d2, 0x0013, 0x7f81, 0x0020, 0x5ac1, 0x0013, 0x8000,
+	0x88c2, 0x7f81, 0x0009, 0x0048, 0x0065, 0x006c, 0x006c, 0x006f,
+	0x0020, 0x0077, 0x006f, 0x0072, 0x006c, 0x0064, 0x0021, 0x0000,
+	0x8b83,
+	};
+
+typedef class _chunk_lexer :
+		public lexer {
+
+	public:
+
+		_chunk_lexer(void);
+
+		_chunk_lexer(
+			const std::string &input
+			);
+
+		bool enumerate_chunks(
+			size_t count,
+			std::vector<token> &result
+			);
+
+} chunk_lexer, *chunk_lexer_ptr;
+
+_chunk_lexer::_chunk_lexer(void)
+{
+	return;
+}
+
+_chunk_lexer::_chunk_lexer(
+	const std::string &input
+	) :
+		lexer(input, false)
+{
+	return;
+}
+
+bool 
+_chunk_lexer::enumerate_chunks(
+	size_t count,
+	std::vector<token> &result
+	)
+{
+	size_t iter = 0;
+	bool complete = true;
+	std::vector<lexer_chunk_t> chunk;
+	std::vector<lexer_boundary_t> boundary = _split_chunks(_input_size, count);
+
+	TEST_ASSERT(boundary.size() > 2);
+	chunk.resize(boundary.size() - 1);
+
+	for(; iter < chunk.size(); ++iter) {
+		chunk_lexer worker;
+
+		chunk.at(iter).begin = boundary.at(iter).position;
+		chunk.at(iter).end = boundary.at(iter + 1).position;
+		chunk.at(iter).position = chunk.at(iter).begin;
+		chunk.at(iter).complete = false;
+		worker.lexer_base::initialize(*this);
+
+		if(iter) {
+			worker._set_line(boundary.at(iter).line, boundary.at(iter).position);
+		}
+		worker._enumerate_chunk(chunk.at(iter));
+		TEST_ASSERT(!chunk.at(iter).error);
+		complete = complete && chunk.at(iter).complete;
+		result.insert(result.end(), chunk.at(iter).result.begin(), chunk.at(iter).result.end());
+	}
+
+	return complete;
+}
+
+static void 
+write_file(
+	const std::string &path,
+	const std::string &text
+	)
+{
+	std::ofstream file(path.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+	TEST_ASSERT(file);
+	file << text;
+}
+
+static std::string 
+discover_error(
+	lexer &lex
+	)
+{
+	std::string result;
+
+	try {
+		lex.discover();
+	} catch(std::runtime_error &exc) {
+		result = exc.what();
+	}
+
+	return result;
+}
+
+static std::string 
+edit_error(
+	assembler &assemb,
+	size_t position,
+	size_t length,
+	const std::string &text
+	)
+{
+	std::string result;
+
+	try {
+		assemb.edit(position, length, text);
+	} catch(std::runtime_error &exc) {
+		result = exc.what();
+	}
+
+	return result;
+}
+
+static std::string 
+generate_chunk_program(
+	size_t line_count
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < line_count; ++iter) {
+		ss << ":loop_" << iter << " set a, " << iter << " ; \"quoted" << std::endl
+			<< "\tdat \"" << std::string(iter % TEST_CHUNK_PADDING, 'x') << std::endl
+			<< "b ; c" << std::endl << "\", 0" << std::endl;
+	}
+
+	return ss.str();
+}
+
+static std::string 
+generate_error(
+	assembler &assemb
+	)
+{
+	std::string result;
+
+	try {
+		assemb.generate(std::string(), false);
+	} catch(std::runtime_error &exc) {
+		result = exc.what();
+	}
+
+	return result;
+}
+
+static std::string 
+generate_pipeline_program(
+	size_t line_count,
+	size_t padding,
+	size_t error_line
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < line_count; ++iter) {
+
+		if(iter == error_line) {
+			ss << TEST_PIPELINE_ERROR_TEXT;
+		} else if(iter % 2) {
+			ss << "dat \"a;b\"," << iter;
+		} else {
+			ss << ":label_" << iter << " set a,label_" << ((iter + 2) % line_count);
+		}
+
+		if(padding) {
+			ss << " ; " << std::string(padding, 'x');
+		}
+		ss << std::endl;
+	}
+
+	return ss.str();
+}
+
+static std::string 
+generate_program(
+	size_t line_count
+	)
+{
+	size_t iter = 0;
+	std::stringstream ss;
+
+	for(; iter < line_count; ++iter) {
+
+		switch(iter % 3) {
+			case 0:
+				ss << ":label_" << iter << " set a, label_" << (((iter + 3) < line_count) ? (iter + 3) : 0) << std::endl;
+				break;
+			case 1:
+				ss << "\tadd [b+0x" << std::hex << iter << std::dec << "], 0x1f\t; comment" << std::endl;
+				break;
+			default:
+				ss << "\tdat \"text\", " << iter << std::endl;
+				break;
+		}
+	}
+
+	return ss.str();
+}
+
+static std::string 
+lex_error(
+	lexer &lex
+	)
+{
+	std::string result;
+
+	try {
+
+		while(lex.has_next_token()) {
+			lex.move_next_token();
+		}
+	} catch(std::runtime_error &exc) {
+		result = exc.what();
+	}
+
+	return result;
+}
+
+static size_t 
+line_position(
+	const std::string &text,
+	size_t line
+	)
+{
+	size_t result = 0;
+
+	for(; line > 0; --line) {
+		result = text.find(CHARACTER_NEWLINE, result) + 1;
+	}
+
+	return result;
+}
+
+static std::string 
+symbol_text(
+	size_t index
+	)
+{
+	std::stringstream ss;
+
+	ss << TEST_SYMBOL_PREFIX << index;
+
+	return ss.str();
+}
+
+static std::string 
+temporary_directory(void)
+{
+#ifdef _WIN32
+	std::stringstream result;
+	char parent[MAX_PATH + 1] = { 0 };
+
+	TEST_ASSERT(GetTempPathA(MAX_PATH + 1, parent));
+	result << parent << TEST_TEMPORARY_PREFIX << GetCurrentProcessId();
+	TEST_ASSERT(CreateDirectoryA(result.str().c_str(), NULL));
+
+	return result.str();
+#else
+	std::vector<char> path;
+	const char *parent = std::getenv(TEST_TEMPORARY_VARIABLE);
+	std::string result = std::string(parent ? parent : TEST_TEMPORARY_PARENT) + TEST_TEMPORARY_TEMPLATE;
+
+	path.assign(result.begin(), result.end());
+	path.push_back('\0');
+	TEST_ASSERT(mkdtemp(&path[0]));
+
+	return std::string(&path[0]);
+#endif
+}
+
+static void 
+temporary_remove(
+	const std::string &directory,
+	const std::string &path
+	)
+{
+	std::remove(path.c_str());
+#ifdef _WIN32
+	RemoveDirectoryA(directory.c_str());
+#else
+	rmdir(directory.c_str());
+#endif
+}
+
+static std::string 
+unit_text(
+	include_unit_t &unit
+	)
+{
+	std::string result;
+	std::vector<token>::iterator token_iter = unit.tokens.begin();
+
+	for(; token_iter != unit.tokens.end(); ++token_iter) {
+		result += token_iter->get_text();
+	}
+
+	return result;
+}
+
+static void 
+test_assemble_sample(void)
+{
+	assembler assemb(SAMPLE_PROGRAM, false);
+
+	assemb.generate(std::string(), false);
+	TEST_ASSERT(assemb.get_binary_data() == std::vector<word_t>(SAMPLE_BINARY, SAMPLE_BINARY 
+		+ (sizeof(SAMPLE_BINARY) / sizeof(word_t))));
+}
+
+static void 
+test_edit_error(void)
+{
+	size_t position;
+	std::vector<word_t> binary;
+	std::string error, input = generate_program(TEST_EDIT_LINE_COUNT), invalid;
+	assembler assemb(input, false);
+
+	assemb.generate(std::string(), false);
+	binary = assemb.get_binary_data();
+	position = line_position(input, TEST_EDIT_LINE_COUNT / 2);
+	invalid = input;
+	invalid.insert(position, TEST_EDIT_ERROR_TEXT);
+
+	assembler fresh(invalid, false);
+
+	error = generate_error(fresh);
+	TEST_ASSERT(!error.empty());
+	TEST_ASSERT(edit_error(assemb, position, 0, TEST_EDIT_ERROR_TEXT) == error);
+	TEST_ASSERT(generate_error(assemb) == error);
+	invalid.insert(0, TEST_EDIT_TEXT);
+
+	assembler shifted(invalid, false);
+
+	error = generate_error(shifted);
+	TEST_ASSERT(edit_error(assemb, 0, 0, TEST_EDIT_TEXT) == error);
+	TEST_ASSERT(generate_error(assemb) == error);
+	assemb.edit(position + std::string(TEST_EDIT_TEXT).size(), std::string(TEST_EDIT_ERROR_TEXT).size(), std::string());
+	assemb.edit(0, std::string(TEST_EDIT_TEXT).size(), std::string());
+	assemb.generate(std::string(), false);
+	TEST_ASSERT(assemb.get_binary_data() == binary);
+}
+
+static void 
+test_edit_middle(void)
+{
+	size_t position;
+	std::vector<word_t> binary;
+	std::string edited, input = generate_program(TEST_EDIT_LINE_COUNT);
+	assembler assemb(input, false);
+
+	assemb.generate(std::string(), false);
+	binary = assemb.get_binary_data();
+	position = line_position(input, TEST_EDIT_LINE_COUNT / 2);
+	edited = input;
+	edited.insert(position, TEST_EDIT_TEXT);
+	assemb.edit(position, 0, TEST_EDIT_TEXT);
+	assemb.generate(std::string(), false);
+
+	assembler fresh(edited, false);
+
+	fresh.generate(std::string(), false);
+	TEST_ASSERT(assemb.get_binary_data() == fresh.get_binary_data());
+	assemb.edit(position, std::string(TEST_EDIT_TEXT).size(), std::string());
+	assemb.generate(std::string(), false);
+	TEST_ASSERT(assemb.get_binary_data() == binary);
+}
+
+static void 
+test_encode_error_order(void)
+{
+	std::string error;
+	assembler assemb(TEST_ENCODE_ERROR_PROGRAM, false);
+
+	error = generate_error(assemb);
+	TEST_ASSERT(error.find(TEST_ENCODE_ERROR_MESSAGE) != std::string::npos);
+}
+
+static void 
+test_forward_reference(void)
+{
+	assembler assemb(SAMPLE_PROGRAM, false);
+
+	assemb.generate(std::string(), false);
+	TEST_ASSERT(assemb.get_pass_count() == TEST_FORWARD_PASS_COUNT);
+	TEST_ASSERT(assemb.get_binary_data() == std::vector<word_t>(SAMPLE_BINARY, SAMPLE_BINARY 
+		+ (sizeof(SAMPLE_BINARY) / sizeof(word_t))));
+}
+
+static void 
+test_include_cache(void)
+{
+	include_cache cache;
+	size_t hit_count, miss_count;
+	std::string directory = temporary_directory(), first, path, repeat, second;
+
+	path = directory + "/" + TEST_INCLUDE_PATH;
+	write_file(path, "\tset a, 0x1234\n");
+	first = unit_text(cache.load(path));
+	repeat = unit_text(cache.load(path));
+	hit_count = cache.get_hit_count();
+	write_file(path, "\tset b, 0x4321\n");
+	second = unit_text(cache.load(path));
+	miss_count = cache.get_miss_count();
+	temporary_remove(directory, path);
+	TEST_ASSERT(repeat == first);
+	TEST_ASSERT(hit_count == 1);
+	TEST_ASSERT(second != first);
+	TEST_ASSERT(miss_count == 2);
+	TEST_ASSERT(cache.size() == 1);
+}
+
+static void 
+test_keyword_hash(void)
+{
+	std::string text;
+	const std::string *subtypes;
+	size_t iter = 0, position, subtype, type;
+
+	for(; iter < KEYWORD_HASH_LENGTH; ++iter) {
+
+		if(!KEYWORD_HASH[iter].text) {
+			continue;
+		}
+		TEST_ASSERT(KEYWORD_HASH_VALUE(KEYWORD_HASH[iter].text, KEYWORD_HASH[iter].length) == iter);
+		TEST_ASSERT(KEYWORD_HASH[iter].subtype < TOKEN_TYPE_LENGTH(KEYWORD_HASH[iter].type));
+		TEST_ASSERT(TOKEN_TYPE_STRING(KEYWORD_HASH[iter].type)[KEYWORD_HASH[iter].subtype] == KEYWORD_HASH[iter].text);
+	}
+
+	for(type = 0; type <= MAX_TOKEN; ++type) {
+		subtypes = TOKEN_TYPE_STRING(type);
+
+		if(!subtypes
+				|| (type == TOKEN_SYMBOL)
+				|| (type == TOKEN_VALUE)) {
+			continue;
+		}
+
+		for(position = 0; position < TOKEN_TYPE_LENGTH(type); ++position) {
+			text = subtypes[position];
+			TEST_ASSERT(__determine_keyword(text.c_str(), text.size(), subtype) == type);
+			TEST_ASSERT(subtype == position);
+			TRANSFORM(::tolower, text);
+			TEST_ASSERT(__determine_keyword(text.c_str(), text.size(), subtype) == type);
+			TEST_ASSERT(subtype == position);
+		}
+	}
+}
+
+static void 
+test_lexer_chunk_error(void)
+{
+	std::string error, input = generate_chunk_program(TEST_CHUNK_LINE_COUNT) + TEST_CHUNK_ERROR_TEXT;
+	std::vector<token> chunked;
+	chunk_lexer lex(input);
+	lexer parallel(input, false), serial(input, false);
+
+	TEST_ASSERT(!lex.enumerate_chunks(TEST_CHUNK_COUNT, chunked));
+	error = lex_error(serial);
+	TEST_ASSERT(error.find(TEST_CHUNK_ERROR_MESSAGE) != std::string::npos);
+
+	TEST_ASSERT(discover_error(parallel) == error);
+}
+
+static void 
+test_lexer_chunk_split(void)
+{
+	token_view view;
+	size_t position = 0;
+	std::vector<token> chunked;
+	std::string input = generate_chunk_program(TEST_CHUNK_LINE_COUNT);
+	chunk_lexer lex(input);
+	lexer serial(input, false);
+
+	TEST_ASSERT(lex.enumerate_chunks(TEST_CHUNK_COUNT, chunked));
+
+	while(serial.has_next_token()) {
+		view = serial.move_next_token();
+
+		if(view.get_type() == TOKEN_END) {
+			break;
+		}
+		TEST_ASSERT(position < chunked.size());
+		TEST_ASSERT(view.get_type() == chunked.at(position).get_type());
+		TEST_ASSERT(view.get_subtype() == chunked.at(position).get_subtype());
+		TEST_ASSERT(view.get_line() == chunked.at(position).get_line());
+		TEST_ASSERT(view.get_text() == chunked.at(position).get_text());
+		++position;
+	}
+	TEST_ASSERT(position == chunked.size());
+}
+
+static void 
+test_pipeline(void)
+{
+	std::string error, 
+		error_input = generate_pipeline_program(TEST_PIPELINE_LINE_COUNT, TEST_PIPELINE_PADDING, TEST_PIPELINE_ERROR_LINE), 
+		input = generate_pipeline_program(TEST_PIPELINE_LINE_COUNT, TEST_PIPELINE_PADDING, TEST_PIPELINE_LINE_COUNT), 
+		serial_error_input = generate_pipeline_program(TEST_PIPELINE_LINE_COUNT, 0, TEST_PIPELINE_ERROR_LINE), 
+		serial_input = generate_pipeline_program(TEST_PIPELINE_LINE_COUNT, 0, TEST_PIPELINE_LINE_COUNT);
+	assembler pipelined(input, false), pipelined_error(error_input, false), serial(serial_input, false), 
+		serial_error(serial_error_input, false);
+
+	TEST_ASSERT(input.size() > (PARSER_CHUNK_LENGTH_MIN * TEST_PIPELINE_CHUNK_COUNT));
+	TEST_ASSERT(serial_input.size() < (PARSER_CHUNK_LENGTH_MIN * 2));
+	pipelined.generate(std::string(), false);
+	serial.generate(std::string(), false);
+	TEST_ASSERT(!serial.get_binary_data().empty());
+	TEST_ASSERT(pipelined.get_binary_data() == serial.get_binary_data());
+	error = generate_error(pipelined_error);
+	TEST_ASSERT(error.find(TEST_PIPELINE_ERROR_MESSAGE) != std::string::npos);
+	TEST_ASSERT(error == generate_error(serial_error));
+}
+
+static void 
+test_symbol_table(void)
+{
+	symid_t id;
+	std::string text;
+	size_t iter = 0;
+	symbol_table copy, table;
+	assembler assemb(TEST_SYMBOL_UNDEFINED_PROGRAM, false);
+
+	for(; iter < TEST_SYMBOL_COUNT; ++iter) {
+		text = symbol_text(iter);
+		TEST_ASSERT(table.find(text.c_str(), text.size()) == INVALID_SYMBOL_ID);
+		TEST_ASSERT(table.intern(text.c_str(), text.size()) == iter);
+	}
+	copy = table;
+
+	for(iter = 0; iter < TEST_SYMBOL_COUNT; ++iter) {
+		text = symbol_text(iter);
+		id = copy.find(text.c_str(), text.size());
+		TEST_ASSERT(id == iter);
+		TEST_ASSERT(table.intern(text.c_str(), text.size()) == id);
+		TEST_ASSERT(copy.get_text(id) == text);
+		TEST_ASSERT(copy.get_text_length(id) == text.size());
+		TEST_ASSERT(copy.find(text.c_str(), text.size() - 1) != id);
+	}
+	TEST_ASSERT(table.size() == TEST_SYMBOL_COUNT);
+	TEST_ASSERT(copy.size() == TEST_SYMBOL_COUNT);
+	text = symbol_text(TEST_SYMBOL_COUNT);
+	TEST_ASSERT(copy.find(text.c_str(), text.size()) == INVALID_SYMBOL_ID);
+	TEST_ASSERT(generate_error(assemb).find(TEST_SYMBOL_UNDEFINED_MESSAGE) != std::string::npos);
+}
+
+static void 
+test_token_store(void)
+{
+	tokid_t id;
+	bool thrown = false;
+	token_store store;
+	std::string source = TEST_TOKEN_SOURCE;
+	token label(TOKEN_LABEL), overflow(TOKEN_VALUE, VALUE_INTEGER), pooled(TOKEN_VALUE, VALUE_STRING_VAR), 
+		viewed(TOKEN_VALUE, VALUE_HEXIDECIMAL);
+
+	store.set_source(source.c_str());
+	label.set_line(TEST_TOKEN_LINE);
+	label.set_text(TEST_TOKEN_LABEL);
+	id = store.append(label);
+	TEST_ASSERT((id == 0) && (label.get_id() == id));
+	TEST_ASSERT(store.get_type(id) == TOKEN_LABEL);
+	TEST_ASSERT(store.get_text(id) == TEST_TOKEN_LABEL);
+	TEST_ASSERT(store.get_line(id) == TEST_TOKEN_LINE);
+	TEST_ASSERT(store.get_symbol(id) != INVALID_SYMBOL_ID);
+	TEST_ASSERT(store.get_symbol(store.append(label)) == store.get_symbol(id));
+	viewed.set_text_view(source.c_str(), TEST_TOKEN_VALUE_LENGTH);
+	viewed.set_value(TEST_TOKEN_VALUE);
+	id = store.append(viewed);
+	TEST_ASSERT(store.get_subtype(id) == VALUE_HEXIDECIMAL);
+	TEST_ASSERT(store.get_value(id) == TEST_TOKEN_VALUE);
+	TEST_ASSERT(store.get_line(id) == INVALID_TYPE);
+	TEST_ASSERT(store.get_mode(id) == INVALID_TYPE);
+	TEST_ASSERT(store.get_text_data(id) == source.c_str());
+	store.set_mode(id, ADDRESSING_MODE_LITERAL);
+	TEST_ASSERT(store.get_mode(id) == ADDRESSING_MODE_LITERAL);
+	pooled.set_text(TEST_TOKEN_TEXT);
+	TEST_ASSERT(store.get_text(store.append(pooled)) == TEST_TOKEN_TEXT);
+	overflow.set_value((size_t) MAX_WORD + 1);
+	TEST_ASSERT(store.get_value(store.append(overflow)) == ((size_t) MAX_WORD + 1));
+	store.pool_text();
+	source.assign(source.size(), ' ');
+	TEST_ASSERT(store.get_text(id) == std::string(TEST_TOKEN_SOURCE).substr(0, TEST_TOKEN_VALUE_LENGTH));
+	TEST_ASSERT(store.get(id).get_text() == store.get_text(id));
+	TEST_ASSERT(store.size() == TEST_TOKEN_COUNT);
+
+	try {
+		store.get_type((tokid_t) store.size());
+	} catch(std::runtime_error &) {
+		thrown = true;
+	}
+	TEST_ASSERT(thrown);
+}
+
+static void 
+test_token_store_origin(void)
+{
+	size_t line;
+	tokid_t id = 0;
+	std::string origin;
+	token_store merged, store;
+	std::vector<tokid_t> order;
+	token tok(TOKEN_VALUE, VALUE_INTEGER);
+
+	for(; id < TEST_ORIGIN_TOKEN_COUNT; ++id) {
+		tok.set_line(id);
+		TEST_ASSERT(store.append(tok, TEST_ORIGIN_STRING(id)) == id);
+		order.insert(order.begin(), id);
+	}
+	store.shift_lines(TEST_ORIGIN_SHIFTED, TEST_ORIGIN_SHIFT_LINE, TEST_ORIGIN_SHIFT);
+	merged.append(store, order);
+	TEST_ASSERT(merged.size() == store.size());
+
+	for(id = 0; id < TEST_ORIGIN_TOKEN_COUNT; ++id) {
+		origin = TEST_ORIGIN_STRING(id);
+		line = id;
+
+		if((origin == TEST_ORIGIN_SHIFTED)
+				&& (line >= TEST_ORIGIN_SHIFT_LINE)) {
+			line += TEST_ORIGIN_SHIFT;
+		}
+		TEST_ASSERT(store.get_origin(id) == origin);
+		TEST_ASSERT(store.get(id).get_origin() == origin);
+		TEST_ASSERT(store.get_line(id) == line);
+		TEST_ASSERT(merged.get_origin(id) == TEST_ORIGIN_STRING(order.at(id)));
+		TEST_ASSERT(merged.get_line(id) == store.get_line(order.at(id)));
+	}
+}
+
+static void 
+test_uuid_generate(void)
+{
+	uuidl_t id;
+	bool thrown = false;
+	size_t iter = 0;
+	uuid_generator generator, sequential;
+	std::vector<uuidl_t> batch, output;
+
+	generator.initialize(TEST_UUID_SEED);
+	sequential.initialize(TEST_UUID_SEED);
+	id = sequential.generate_long_id(false);
+	TEST_ASSERT((id.block0 == TEST_UUID_BLOCK0) && (id.block1 == TEST_UUID_BLOCK1));
+	sequential.initialize(TEST_UUID_SEED);
+	generator.generate_long_ids(TEST_UUID_BATCH_COUNT, batch, false);
+	TEST_ASSERT(batch.size() == TEST_UUID_BATCH_COUNT);
+
+	for(; iter < TEST_UUID_BATCH_COUNT; ++iter) {
+		TEST_ASSERT(batch.at(iter) == sequential.generate_long_id(false));
+		TEST_ASSERT(generator.is_unique_long_id(batch.at(iter)));
+	}
+	generator.initialize(TEST_UUID_SEED);
+	generator.register_long_id(batch.at(TEST_UUID_BATCH_COUNT / 2));
+
+	try {
+		generator.generate_long_ids(TEST_UUID_BATCH_COUNT, output, true);
+	} catch(std::runtime_error &) {
+		thrown = true;
+	}
+	TEST_ASSERT(thrown);
+	TEST_ASSERT(output.empty());
+	TEST_ASSERT(generator.is_unique_long_id(batch.front()));
+	TEST_ASSERT(!generator.is_unique_long_id(batch.at(TEST_UUID_BATCH_COUNT / 2)));
+	generator.unregister_long_id(batch.at(TEST_UUID_BATCH_COUNT / 2));
+	generator.generate_long_ids(TEST_UUID_BATCH_COUNT, output, true);
+	TEST_ASSERT(output.size() == TEST_UUID_BATCH_COUNT);
+
+	for(iter = 0; iter < TEST_UUID_BATCH_COUNT; ++iter) {
+		TEST_ASSERT(!generator.is_unique_long_id(output.at(iter)));
+	}
+}
+
+static void 
+test_uuid_hash_set(void)
+{
+	uuidl_t id;
+	size_t iter = 0;
+	std::hash<uuidl_t> hash;
+	uuid_hash_set copy, set;
+	std::vector<uuidl_t> collision;
+
+	for(id.block1 = TEST_HASH_SET_BLOCK; collision.size() < TEST_HASH_SET_COLLISION_COUNT; ++id.block0) {
+
+		if(!(hash(id) & (UUID_HASH_SET_SLOT_COUNT_MIN - 1))) {
+			collision.push_back(id);
+		}
+	}
+
+	for(; iter < collision.size(); ++iter) {
+		TEST_ASSERT(set.insert(collision.at(iter)));
+		TEST_ASSERT(!set.insert(collision.at(iter)));
+	}
+	TEST_ASSERT(set.erase(collision.at(TEST_HASH_SET_COLLISION_COUNT / 2)));
+	TEST_ASSERT(!set.erase(collision.at(TEST_HASH_SET_COLLISION_COUNT / 2)));
+	TEST_ASSERT(set.erase(collision.front()));
+
+	for(iter = 0; iter < collision.size(); ++iter) {
+		TEST_ASSERT(set.contains(collision.at(iter)) 
+				== ((iter != 0) && (iter != (TEST_HASH_SET_COLLISION_COUNT / 2))));
+	}
+	TEST_ASSERT(set.size() == (TEST_HASH_SET_COLLISION_COUNT - 2));
+	ZERO_LONG_ID(id);
+	TEST_ASSERT(!set.contains(id));
+	TEST_ASSERT(set.insert(id));
+	TEST_ASSERT(!set.insert(id));
+	TEST_ASSERT(set.contains(id));
+	TEST_ASSERT(set.erase(id));
+	TEST_ASSERT(!set.contains(id));
+	set.clear();
+
+	for(iter = 0; iter < TEST_HASH_SET_COUNT; ++iter) {
+		id.block0 = iter;
+		id.block1 = TEST_HASH_SET_BLOCK;
+		TEST_ASSERT(set.insert(id));
+	}
+	copy = set;
+
+	for(iter = 0; iter < TEST_HASH_SET_COUNT; iter += 2) {
+		id.block0 = iter;
+		TEST_ASSERT(set.erase(id));
+	}
+	TEST_ASSERT(set.size() == (TEST_HASH_SET_COUNT / 2));
+	TEST_ASSERT(copy.size() == TEST_HASH_SET_COUNT);
+
+	for(iter = 0; iter < TEST_HASH_SET_COUNT; ++iter) {
+		id.block0 = iter;
+		TEST_ASSERT(set.contains(id) == ((iter % 2) != 0));
+		TEST_ASSERT(copy.contains(id));
+	}
+	id.block0 = TEST_HASH_SET_COUNT;
+	TEST_ASSERT(!copy.contains(id));
+}
+
+static const test_t TEST[] = {
+	{ test_assemble_sample, "assemble_sample", },
+	{ test_edit_error, "edit_error", },
+	{ test_edit_middle, "edit_middle", },
+	{ test_encode_error_order, "encode_error_order", },
+	{ test_forward_reference, "forward_reference", },
+	{ test_include_cache, "include_cache", },
+	{ test_keyword_hash, "keyword_hash", },
+	{ test_lexer_chunk_error, "lexer_chunk_error", },
+	{ test_lexer_chunk_split, "lexer_chunk_split", },
+	{ test_pipeline, "pipeline", },
+	{ test_symbol_table, "symbol_table", },
+	{ test_token_store, "token_store", },
+	{ test_token_store_origin, "token_store_origin", },
+	{ test_uuid_generate, "uuid_generate", },
+	{ test_uuid_hash_set, "uuid_hash_set", },
+	};
+
+#define TEST_COUNT (sizeof(TEST) / sizeof(test_t))
+
+size_t 
+run(
+	bool verbose
+	)
+{
+	size_t failed = 0, iter = 0;
+
+	for(; iter < TEST_COUNT; ++iter) {
+
+		if(verbose) {
+			std::cout << TEST[iter].name << "... ";
+		}
+
+		try {
+			TEST[iter].function();
+
+			if(verbose) {
+				std::cout << "Passed." << std::endl;
+			}
+		} catch(std::runtime_error &exc) {
+
+			if(!verbose) {
+				std::cout << TEST[iter].name << "... ";
+			}
+			std::cout << "FAILED! (" << exc.what() << ")" << std::endl;
+			++failed;
+		}
+	}
+
+	return failed;
+}
+}
\ No newline at end of file
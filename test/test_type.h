@@ -0,0 +1,106 @@
+/*
+ * test_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_TYPE_H_
+#define TEST_TYPE_H_
+
+#include "type.h"
+
+enum {
+	TEST_EXCEPTION_ASSERTION_FAILED = 0,
+};
+
+static const std::string TEST_EXCEPTION_STR[] = {
+	"Assertion failed",
+};
+
+static const std::string TEST_ORIGIN_STR[] = {
+	"host.asm", "host.asm", "include.asm", "include.asm", "host.asm", "", "nested.asm",
+};
+
+#define TEST_CHUNK_COUNT (7)
+#define TEST_CHUNK_ERROR_MESSAGE "Unterminated string literal"
+#define TEST_CHUNK_ERROR_TEXT "\tdat \"open\n"
+#define TEST_CHUNK_LINE_COUNT (50000)
+#define TEST_CHUNK_PADDING (13)
+#define TEST_EDIT_ERROR_TEXT "\tset a, :label_3\n"
+#define TEST_EDIT_LINE_COUNT (10000)
+#define TEST_EDIT_TEXT ":inserted set pc, label_9\n\tdat 0x1, \"ab\"\n"
+#define TEST_ENCODE_ERROR_MESSAGE "Expected open brace: [SYMBOL, :] {ln. 3"
+#define TEST_ENCODE_ERROR_PROGRAM "\tdat 0x10000\n\tset a, 1\n\tset a, :\n"
+#define TEST_EXCEPTION_HEADER "TEST"
+#define TEST_FORWARD_PASS_COUNT (1)
+#define TEST_HASH_SET_BLOCK (0x5a5a5a5a5a5a5a5aULL)
+#define TEST_HASH_SET_COLLISION_COUNT (8)
+#define TEST_HASH_SET_COUNT (100000)
+#define TEST_INCLUDE_PATH "test_include.asm"
+#define TEST_ORIGIN_COUNT (sizeof(TEST_ORIGIN_STR) / sizeof(std::string))
+#define TEST_ORIGIN_SHIFT (10)
+#define TEST_ORIGIN_SHIFT_LINE (1500)
+#define TEST_ORIGIN_SHIFTED "include.asm"
+#define TEST_ORIGIN_TOKEN_COUNT (3000)
+#define TEST_PIPELINE_CHUNK_COUNT (4)
+#define TEST_PIPELINE_ERROR_LINE (15000)
+#define TEST_PIPELINE_ERROR_MESSAGE "Expected open brace: [SYMBOL, :] {ln. 15001"
+#define TEST_PIPELINE_ERROR_TEXT "\tset a, :"
+#define TEST_PIPELINE_LINE_COUNT (20000)
+#define TEST_PIPELINE_PADDING (48)
+#define TEST_SYMBOL_COUNT (100000)
+#define TEST_SYMBOL_PREFIX "label_"
+#define TEST_SYMBOL_UNDEFINED_MESSAGE "Label undefined"
+#define TEST_SYMBOL_UNDEFINED_PROGRAM ":defined set pc, undefined\n"
+#define TEST_TEMPORARY_PARENT "/tmp"
+#define TEST_TEMPORARY_PREFIX "dasm16_test_"
+#define TEST_TEMPORARY_TEMPLATE "/" TEST_TEMPORARY_PREFIX "XXXXXX"
+#define TEST_TEMPORARY_VARIABLE "TMPDIR"
+#define TEST_TOKEN_COUNT (5)
+#define TEST_TOKEN_LABEL "loop"
+#define TEST_TOKEN_LINE (7)
+#define TEST_TOKEN_SOURCE "0x1f, \"text\""
+#define TEST_TOKEN_TEXT "text"
+#define TEST_TOKEN_VALUE (0x1f)
+#define TEST_TOKEN_VALUE_LENGTH (4)
+#define TEST_UUID_BATCH_COUNT (2000)
+#define TEST_UUID_BLOCK0 (0xcd0d00325d47f5d7ULL)
+#define TEST_UUID_BLOCK1 (0x5a0afbf6aea87b24ULL)
+#define TEST_UUID_SEED (1234)
+#define MAX_TEST_EXCEPTION TEST_EXCEPTION_ASSERTION_FAILED
+#define SHOW_TEST_EXCEPTION_HEADER true
+
+#define TEST_EXCEPTION_STRING(_T_)\
+	(_T_ > MAX_TEST_EXCEPTION ? UNKNOWN_EXCEPTION : TEST_EXCEPTION_STR[_T_])
+#define TEST_ORIGIN_STRING(_I_) (TEST_ORIGIN_STR[(_I_) % TEST_ORIGIN_COUNT])
+#define THROW_TEST_EXCEPTION(_T_)\
+	THROW_EXCEPTION(TEST_EXCEPTION_HEADER, TEST_EXCEPTION_STRING(_T_), SHOW_TEST_EXCEPTION_HEADER)
+#define THROW_TEST_EXCEPTION_WITH_MESSAGE(_T_, _M_)\
+	THROW_EXCEPTION_WITH_MESSAGE(TEST_EXCEPTION_HEADER, TEST_EXCEPTION_STRING(_T_), _M_, SHOW_TEST_EXCEPTION_HEADER)
+
+#define TEST_ASSERT(_E_)\
+	if(!(_E_)) {\
+		THROW_TEST_EXCEPTION_WITH_MESSAGE(TEST_EXCEPTION_ASSERTION_FAILED, #_E_);\
+	}
+
+typedef void (*test_function_t)(void);
+
+typedef struct _test_t {
+	test_function_t function;
+	const char *name;
+} test_t, *test_ptr;
+
+#endif
\ No newline at end of file